@@ -44,6 +44,7 @@ namespace Sonnet
             objective = new Objective("obj");
 
             if (!object.ReferenceEquals(constraints, null)) constraints.Clear();
+            if (!object.ReferenceEquals(sosConstraints, null)) sosConstraints.Clear();
         }
 
         #region ToString() methods
@@ -170,6 +171,23 @@ namespace Sonnet
             get { return constraints.Count; }
         }
 
+        /// <summary>
+        /// Gets the special ordered sets of this model.
+        /// Use model.Add(..) to add sets.
+        /// </summary>
+        public IEnumerable<SOSConstraint> SOSConstraints
+        {
+            get { return sosConstraints; }
+        }
+
+        /// <summary>
+        /// Gets the number of special ordered sets of this model.
+        /// </summary>
+        public int NumberOfSOSConstraints
+        {
+            get { return sosConstraints.Count; }
+        }
+
         #endregion
 
         #region Add constraints methods
@@ -234,6 +252,19 @@ namespace Sonnet
         {
             return constraints.Find(con => con.Name.Equals(name));
         }
+
+        /// <summary>
+        /// Adds a reference to the given special ordered set to this model.
+        /// All variables of the set must be used in the objective or constraints of this model.
+        /// </summary>
+        /// <param name="sos">The special ordered set to be added.</param>
+        /// <returns>The given special ordered set.</returns>
+        public SOSConstraint Add(SOSConstraint sos)
+        {
+            Ensure.NotNull(sos, "sos");
+            sosConstraints.Add(sos);
+            return sos;
+        }
         #endregion
 
         #region Static Properties
@@ -513,6 +544,7 @@ namespace Sonnet
             objective = new Objective("obj");
             objectiveSense = ObjectiveSense.Minimise;
             constraints = new List<Constraint>();
+            sosConstraints = new List<SOSConstraint>();
 
             if (name != null) Name = name;
             else Name = string.Format("Model_{0}", id);
@@ -525,6 +557,7 @@ namespace Sonnet
         private Objective objective;
         private ObjectiveSense objectiveSense;
         private List<Constraint> constraints;
+        private List<SOSConstraint> sosConstraints;
         private List<Solver> solvers = new List<Solver>();
     }
 }
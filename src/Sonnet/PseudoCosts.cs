@@ -0,0 +1,84 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Text;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// The class PseudoCosts contains the pseudocosts of integer variables learned by the branch and bound of a MIP solve:
+    /// per variable, the average objective change per unit change when branching down or up, and the number of times 
+    /// the variable was branched down or up. The arrays are in the order of the Variables.
+    /// Get the pseudocosts via solver.GetPseudoCosts() after a MIP solve, and use them for the next solve of a 
+    /// similar model via solver.SetPseudoCosts(..), so that Cbc does not have to learn them again by strong branching.
+    /// </summary>
+    public class PseudoCosts
+    {
+        /// <summary>
+        /// Initializes a new instance of the PseudoCosts class with the given pseudocosts. All arrays must have the same length.
+        /// </summary>
+        /// <param name="variables">The variables.</param>
+        /// <param name="downCosts">The down pseudocost per variable.</param>
+        /// <param name="upCosts">The up pseudocost per variable.</param>
+        /// <param name="numberTimesDown">The number of times branched down per variable.</param>
+        /// <param name="numberTimesUp">The number of times branched up per variable.</param>
+        public PseudoCosts(Variable[] variables, double[] downCosts, double[] upCosts, int[] numberTimesDown, int[] numberTimesUp)
+        {
+            Ensure.NotNull(variables, "variables");
+            Ensure.NotNull(downCosts, "downCosts");
+            Ensure.NotNull(upCosts, "upCosts");
+            Ensure.NotNull(numberTimesDown, "numberTimesDown");
+            Ensure.NotNull(numberTimesUp, "numberTimesUp");
+            int n = variables.Length;
+            if (downCosts.Length != n || upCosts.Length != n || numberTimesDown.Length != n || numberTimesUp.Length != n)
+            {
+                throw new ArgumentException("The pseudocosts should have a value per variable.");
+            }
+
+            this.variables = variables;
+            this.downCosts = downCosts;
+            this.upCosts = upCosts;
+            this.numberTimesDown = numberTimesDown;
+            this.numberTimesUp = numberTimesUp;
+        }
+
+        /// <summary>
+        /// Gets the number of variables.
+        /// </summary>
+        public int Count { get { return variables.Length; } }
+
+        /// <summary>
+        /// Gets the variables.
+        /// </summary>
+        public Variable[] Variables { get { return variables; } }
+
+        /// <summary>
+        /// Gets the down pseudocost per variable.
+        /// </summary>
+        public double[] DownCosts { get { return downCosts; } }
+
+        /// <summary>
+        /// Gets the up pseudocost per variable.
+        /// </summary>
+        public double[] UpCosts { get { return upCosts; } }
+
+        /// <summary>
+        /// Gets the number of times branched down per variable.
+        /// </summary>
+        public int[] NumberTimesDown { get { return numberTimesDown; } }
+
+        /// <summary>
+        /// Gets the number of times branched up per variable.
+        /// </summary>
+        public int[] NumberTimesUp { get { return numberTimesUp; } }
+
+        private Variable[] variables;
+        private double[] downCosts;
+        private double[] upCosts;
+        private int[] numberTimesDown;
+        private int[] numberTimesUp;
+    }
+}
@@ -0,0 +1,113 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// Specifies the type of a special ordered set.
+    /// </summary>
+    public enum SOSType
+    {
+        /// <summary>
+        /// At most one variable of the set is nonzero
+        /// </summary>
+        Type1 = 1,
+        /// <summary>
+        /// At most two variables of the set are nonzero, and these are consecutive in the order of the weights
+        /// </summary>
+        Type2 = 2
+    }
+
+    /// <summary>
+    /// The class SOSConstraint represents a special ordered set (SOS) of variables, of type 1 or 2.
+    /// The variables are ordered by their (distinct) weights. Branch and bound branches on the set as a whole,
+    /// instead of on its variables. Use model.Add(..) to add a set to a model.
+    /// Only supported for OsiCbc; the sets are passed to the solver at the next MIP solve.
+    /// </summary>
+    public class SOSConstraint : Named
+    {
+        /// <summary>
+        /// Initializes a new instance of the SOSConstraint class of the given type, for the given variables and weights.
+        /// </summary>
+        /// <param name="variables">The variables of the set.</param>
+        /// <param name="weights">The weights of the variables, which must be distinct. Null for 1, 2, 3, etc.</param>
+        /// <param name="type">The type of the set.</param>
+        /// <param name="name">The name of the set.</param>
+        public SOSConstraint(IEnumerable<Variable> variables, IEnumerable<double> weights = null, SOSType type = SOSType.Type1, string name = null)
+            : base(name)
+        {
+            Ensure.NotNull(variables, "variables");
+
+            this.variables = variables.ToArray();
+            if (this.variables.Length == 0) throw new ArgumentException("A special ordered set needs at least one variable.", "variables");
+            foreach (Variable variable in this.variables) Ensure.NotNull(variable, "variable");
+
+            if (weights != null)
+            {
+                this.weights = weights.ToArray();
+                if (this.weights.Length != this.variables.Length) throw new ArgumentException("The number of weights should equal the number of variables.", "weights");
+            }
+            else this.weights = Enumerable.Range(1, this.variables.Length).Select(i => (double)i).ToArray();
+
+            this.type = type;
+            this.id = numberOfSOSConstraints++;
+
+            if (name == null) Name = string.Format("SOS_{0}", id);
+        }
+
+        /// <summary>
+        /// Gets the variables of this set.
+        /// </summary>
+        public Variable[] Variables { get { return variables; } }
+
+        /// <summary>
+        /// Gets the weights of the variables of this set.
+        /// </summary>
+        public double[] Weights { get { return weights; } }
+
+        /// <summary>
+        /// Gets the type of this set.
+        /// </summary>
+        public SOSType Type { get { return type; } }
+
+        /// <summary>
+        /// Gets or sets the branching priority of this set: sets and variables with a lower value are branched on first.
+        /// Null for the solver default (1000 for Cbc).
+        /// </summary>
+        public int? Priority
+        {
+            get { return priority; }
+            set { priority = value; }
+        }
+
+        /// <summary>
+        /// Returns a System.String that represents the current SOSConstraint.
+        /// </summary>
+        /// <returns>A string that represents the current SOSConstraint.</returns>
+        public override string ToString()
+        {
+            StringBuilder tmp = new StringBuilder();
+            tmp.AppendFormat("{0} : SOS{1} (", Name, (int)type);
+            for (int i = 0; i < variables.Length; i++)
+            {
+                if (i > 0) tmp.Append(", ");
+                tmp.AppendFormat("{0}:{1}", variables[i].Name, weights[i]);
+            }
+            tmp.Append(")");
+            return tmp.ToString();
+        }
+
+        private static int numberOfSOSConstraints = 0;
+
+        private Variable[] variables;
+        private double[] weights;
+        private SOSType type;
+        private int? priority;
+    }
+}
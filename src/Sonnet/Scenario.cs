@@ -0,0 +1,149 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Text;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// The class Scenario describes a variant of the model of a solver by a number of modifications:
+    /// new bounds of variables, new bounds (rhs) of constraints and new objective coefficients.
+    /// Scenarios are solved in batch by solver.SolveScenarios(..), without changing the model or the solver itself.
+    /// All variables and constraints used must be part of the model of that solver.
+    /// </summary>
+    public class Scenario : Named
+    {
+        /// <summary>
+        /// Initializes a new instance of the Scenario class with the given name, and no modifications.
+        /// </summary>
+        /// <param name="name">The name of the new scenario.</param>
+        public Scenario(string name = null)
+            : base(name)
+        {
+            variableBounds = new List<Tuple<Variable, double, double>>();
+            constraintBounds = new List<Tuple<Constraint, double, double>>();
+            objectiveCoefficients = new List<Tuple<Variable, double>>();
+        }
+
+        /// <summary>
+        /// In this scenario, use the given bounds for the given variable.
+        /// </summary>
+        /// <param name="variable">The variable.</param>
+        /// <param name="lower">The lower bound for the variable in this scenario.</param>
+        /// <param name="upper">The upper bound for the variable in this scenario.</param>
+        public void SetVariableBounds(Variable variable, double lower, double upper)
+        {
+            Ensure.NotNull(variable, "variable");
+            variableBounds.Add(new Tuple<Variable, double, double>(variable, lower, upper));
+        }
+
+        /// <summary>
+        /// In this scenario, use the given lower and upper bound (rhs) for the given constraint.
+        /// For example, for a constraint "expr &lt;= 10", use lower = -Infinity and upper = 10.
+        /// </summary>
+        /// <param name="constraint">The constraint.</param>
+        /// <param name="lower">The lower bound for the constraint in this scenario.</param>
+        /// <param name="upper">The upper bound for the constraint in this scenario.</param>
+        public void SetConstraintBounds(Constraint constraint, double lower, double upper)
+        {
+            Ensure.NotNull(constraint, "constraint");
+            constraintBounds.Add(new Tuple<Constraint, double, double>(constraint, lower, upper));
+        }
+
+        /// <summary>
+        /// In this scenario, use the given objective coefficient for the given variable.
+        /// </summary>
+        /// <param name="variable">The variable.</param>
+        /// <param name="value">The objective coefficient for the variable in this scenario.</param>
+        public void SetObjectiveCoefficient(Variable variable, double value)
+        {
+            Ensure.NotNull(variable, "variable");
+            objectiveCoefficients.Add(new Tuple<Variable, double>(variable, value));
+        }
+
+        internal List<Tuple<Variable, double, double>> variableBounds;
+        internal List<Tuple<Constraint, double, double>> constraintBounds;
+        internal List<Tuple<Variable, double>> objectiveCoefficients;
+    }
+
+    /// <summary>
+    /// The class ScenarioResults contains the results of solver.SolveScenarios(..) as compact arrays,
+    /// with one element per scenario in the order of the given scenarios.
+    /// </summary>
+    public class ScenarioResults
+    {
+        internal ScenarioResults(Solver solver, int numberOfScenarios, int numberOfVariables, bool storeSolutions)
+        {
+            this.solver = solver;
+            this.numberOfVariables = numberOfVariables;
+
+            objectiveValues = new double[numberOfScenarios];
+            isProvenOptimal = new bool[numberOfScenarios];
+            isProvenPrimalInfeasible = new bool[numberOfScenarios];
+            isProvenDualInfeasible = new bool[numberOfScenarios];
+            if (storeSolutions) solutions = new double[numberOfScenarios * numberOfVariables];
+        }
+
+        /// <summary>
+        /// Gets the number of scenarios.
+        /// </summary>
+        public int Count { get { return objectiveValues.Length; } }
+
+        /// <summary>
+        /// Gets the objective value per scenario (incl. the objective constant).
+        /// </summary>
+        public double[] ObjectiveValues { get { return objectiveValues; } }
+
+        /// <summary>
+        /// Gets per scenario whether optimality was proven.
+        /// </summary>
+        public bool[] IsProvenOptimal { get { return isProvenOptimal; } }
+
+        /// <summary>
+        /// Gets per scenario whether primal infeasibility was proven.
+        /// </summary>
+        public bool[] IsProvenPrimalInfeasible { get { return isProvenPrimalInfeasible; } }
+
+        /// <summary>
+        /// Gets per scenario whether dual infeasibility was proven.
+        /// </summary>
+        public bool[] IsProvenDualInfeasible { get { return isProvenDualInfeasible; } }
+
+        /// <summary>
+        /// Gets the variable values of all scenarios as one array, that is, the value of the variable at offset j in scenario s
+        /// is at Solutions[s * NumberOfVariables + j]. Use GetValue for the value of a given variable.
+        /// Null, unless solutions were requested.
+        /// </summary>
+        public double[] Solutions { get { return solutions; } }
+
+        /// <summary>
+        /// Gets the number of variables per solution.
+        /// </summary>
+        public int NumberOfVariables { get { return numberOfVariables; } }
+
+        /// <summary>
+        /// Returns the value of the given variable in the solution of the given scenario.
+        /// </summary>
+        /// <param name="scenario">The index of the scenario.</param>
+        /// <param name="variable">The variable.</param>
+        /// <returns>The value of the variable in the solution of the scenario.</returns>
+        public double GetValue(int scenario, Variable variable)
+        {
+            if (solutions == null) throw new SonnetException("The solutions of the scenarios were not stored.");
+            if (scenario < 0 || scenario >= Count) throw new ArgumentOutOfRangeException("scenario");
+
+            return solutions[scenario * numberOfVariables + solver.Offset(variable)];
+        }
+
+        private Solver solver;
+        private int numberOfVariables;
+        internal double[] objectiveValues;
+        internal bool[] isProvenOptimal;
+        internal bool[] isProvenPrimalInfeasible;
+        internal bool[] isProvenDualInfeasible;
+        internal double[] solutions;
+    }
+}
@@ -0,0 +1,154 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Text;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// The class ParametricDirection describes the direction of a parametric analysis:
+    /// for parameter theta, the bounds of variables, the bounds (rhs) of constraints, and the objective coefficients
+    /// become their current value + theta * change.
+    /// Use via solver.Parametrics(..).
+    /// </summary>
+    public class ParametricDirection
+    {
+        /// <summary>
+        /// Initializes a new instance of the ParametricDirection class, without any changes.
+        /// </summary>
+        public ParametricDirection()
+        {
+            variableBoundChanges = new List<Tuple<Variable, double, double>>();
+            constraintBoundChanges = new List<Tuple<Constraint, double, double>>();
+            objectiveChanges = new List<Tuple<Variable, double>>();
+        }
+
+        /// <summary>
+        /// Set the change per unit of theta of the lower and upper bound of the given variable.
+        /// </summary>
+        /// <param name="variable">The variable.</param>
+        /// <param name="lowerChange">The change of the lower bound.</param>
+        /// <param name="upperChange">The change of the upper bound.</param>
+        public void SetVariableBoundsChange(Variable variable, double lowerChange, double upperChange)
+        {
+            Ensure.NotNull(variable, "variable");
+            variableBoundChanges.Add(new Tuple<Variable, double, double>(variable, lowerChange, upperChange));
+        }
+
+        /// <summary>
+        /// Set the change per unit of theta of the lower and upper bound (rhs) of the given constraint.
+        /// For example, for a constraint "expr &lt;= 10", use lowerChange = 0 and upperChange = 1.
+        /// </summary>
+        /// <param name="constraint">The constraint.</param>
+        /// <param name="lowerChange">The change of the lower bound.</param>
+        /// <param name="upperChange">The change of the upper bound.</param>
+        public void SetConstraintBoundsChange(Constraint constraint, double lowerChange, double upperChange)
+        {
+            Ensure.NotNull(constraint, "constraint");
+            constraintBoundChanges.Add(new Tuple<Constraint, double, double>(constraint, lowerChange, upperChange));
+        }
+
+        /// <summary>
+        /// Set the change per unit of theta of the objective coefficient of the given variable.
+        /// </summary>
+        /// <param name="variable">The variable.</param>
+        /// <param name="change">The change of the objective coefficient.</param>
+        public void SetObjectiveChange(Variable variable, double change)
+        {
+            Ensure.NotNull(variable, "variable");
+            objectiveChanges.Add(new Tuple<Variable, double>(variable, change));
+        }
+
+        internal List<Tuple<Variable, double, double>> variableBoundChanges;
+        internal List<Tuple<Constraint, double, double>> constraintBoundChanges;
+        internal List<Tuple<Variable, double>> objectiveChanges;
+    }
+
+    /// <summary>
+    /// The class ParametricsResult contains the result of solver.Parametrics(..): the breakpoints (thetas) and
+    /// the objective value at each breakpoint. Between the breakpoints, the objective value is linear in theta.
+    /// </summary>
+    public class ParametricsResult
+    {
+        internal ParametricsResult(double[] thetas, double[] objectiveValues, double endingTheta, int status)
+        {
+            this.thetas = thetas;
+            this.objectiveValues = objectiveValues;
+            this.endingTheta = endingTheta;
+            this.status = status;
+        }
+
+        /// <summary>
+        /// Gets the thetas at which the objective value was reported, in increasing order.
+        /// </summary>
+        public double[] Thetas { get { return thetas; } }
+
+        /// <summary>
+        /// Gets the objective value (incl. the objective constant) at each of the Thetas.
+        /// </summary>
+        public double[] ObjectiveValues { get { return objectiveValues; } }
+
+        /// <summary>
+        /// Gets the maximum theta reached.
+        /// </summary>
+        public double EndingTheta { get { return endingTheta; } }
+
+        /// <summary>
+        /// Gets the status: 0 if the requested ending theta was reached, 1 if the problem became infeasible,
+        /// 2 if the problem became unbounded, and -1 if there was an error in the ranges.
+        /// </summary>
+        public int Status { get { return status; } }
+
+        private double[] thetas;
+        private double[] objectiveValues;
+        private double endingTheta;
+        private int status;
+    }
+
+    /// <summary>
+    /// The class RangingResult contains the result of solver.Ranging(..): the cost ranges of the given variables
+    /// and the rhs ranges of the given constraints, as (non-negative) amounts by which the objective coefficient or rhs can 
+    /// increase or decrease before the optimal basis changes. Unlimited amounts are MathUtils.Infinity.
+    /// The arrays are in the order of the given variables and constraints.
+    /// </summary>
+    public class RangingResult
+    {
+        internal RangingResult(double[] costIncrease, double[] costDecrease, double[] rhsIncrease, double[] rhsDecrease)
+        {
+            this.costIncrease = costIncrease;
+            this.costDecrease = costDecrease;
+            this.rhsIncrease = rhsIncrease;
+            this.rhsDecrease = rhsDecrease;
+        }
+
+        /// <summary>
+        /// Gets per variable the amount by which its objective coefficient can increase, while the current basis remains optimal.
+        /// </summary>
+        public double[] CostIncrease { get { return costIncrease; } }
+
+        /// <summary>
+        /// Gets per variable the amount by which its objective coefficient can decrease, while the current basis remains optimal.
+        /// </summary>
+        public double[] CostDecrease { get { return costDecrease; } }
+
+        /// <summary>
+        /// Gets per constraint the amount by which its rhs can increase, while the current basis remains optimal.
+        /// For a non-binding constraint, this is up to the row activity for a &gt;= constraint, and unlimited otherwise.
+        /// </summary>
+        public double[] RhsIncrease { get { return rhsIncrease; } }
+
+        /// <summary>
+        /// Gets per constraint the amount by which its rhs can decrease, while the current basis remains optimal.
+        /// For a non-binding constraint, this is down to the row activity for a &lt;= constraint, and unlimited otherwise.
+        /// </summary>
+        public double[] RhsDecrease { get { return rhsDecrease; } }
+
+        private double[] costIncrease;
+        private double[] costDecrease;
+        private double[] rhsIncrease;
+        private double[] rhsDecrease;
+    }
+}
@@ -8,11 +8,95 @@ using System.Text;
 using System.Runtime.InteropServices;
 using System.Diagnostics;
 using System.Linq;
+using System.Threading.Tasks;
+using System.Collections.Concurrent;
+using System.Globalization;
 
 using COIN;
 
 namespace Sonnet
 {
+    /// <summary>
+    /// The algorithm used for solving LPs (and the relaxations of MIPs that are solved as LP).
+    /// </summary>
+    public enum LPAlgorithm
+    {
+        /// <summary>
+        /// Use the default algorithm of the OsiSolver (initialSolve or resolve)
+        /// </summary>
+        Default,
+        /// <summary>
+        /// Race the dual simplex, primal simplex and barrier concurrently, each on its own thread. The first to finish wins.
+        /// Only supported for OsiClp and OsiCbc (with Clp); otherwise, and for QP, the Default is used.
+        /// </summary>
+        Race,
+        /// <summary>
+        /// Use the barrier (interior point), see also Solver.BarrierCholesky and Solver.BarrierCrossover. Also for QP.
+        /// Only supported for OsiClp and OsiCbc (with Clp); otherwise the Default is used.
+        /// </summary>
+        Barrier
+    }
+
+    /// <summary>
+    /// The preprocessing (CglPreProcess) of MIPs before branch and bound. The options can be combined.
+    /// </summary>
+    [Flags]
+    public enum MIPPreProcess
+    {
+        /// <summary>
+        /// No preprocessing
+        /// </summary>
+        None = 0,
+        /// <summary>
+        /// Probing (CglProbing), to fix variables and tighten bounds, incl. its disaggregation cuts
+        /// </summary>
+        Probing = 1,
+        /// <summary>
+        /// Find and merge cliques
+        /// </summary>
+        Cliques = 2,
+        /// <summary>
+        /// Coefficient tightening (strengthening) by probing
+        /// </summary>
+        CoefficientTightening = 4,
+        /// <summary>
+        /// Remove duplicate rows
+        /// </summary>
+        DuplicateRows = 8,
+        /// <summary>
+        /// All of the above
+        /// </summary>
+        All = Probing | Cliques | CoefficientTightening | DuplicateRows
+    }
+
+    /// <summary>
+    /// The node selection of the branch and bound of MIPs: the order in which the nodes of the tree are explored.
+    /// </summary>
+    public enum MIPNodeSelection
+    {
+        /// <summary>
+        /// The Cbc default (CbcCompareDefault): depth-first until a solution, then a mix of objective and number of infeasibilities
+        /// </summary>
+        Default,
+        /// <summary>
+        /// Depth-first (CbcCompareDepth): the deepest node first
+        /// </summary>
+        DepthFirst,
+        /// <summary>
+        /// Best-bound (CbcCompareObjective): the node with the best objective value first
+        /// </summary>
+        BestBound,
+        /// <summary>
+        /// Best-estimate (CbcCompareEstimate): the node with the best estimated objective value of a solution first
+        /// </summary>
+        BestEstimate,
+        /// <summary>
+        /// Depth-first dives until the first solution, then best-bound (CbcCompareHybridDive). 
+        /// See HybridMaximumDiveDepth and HybridDiveNodeLimit.
+        /// </summary>
+        Hybrid
+    }
+
     /// <summary>
     /// The Solver class is responsible of optimizing the problems represented by a Model.
     /// This class is the main link back to the COIN Osi solvers (OsiSolverInterface) through the SonnetWrapper.
@@ -102,6 +186,430 @@ namespace Sonnet
             get { return this.autoResetMIPSolve; }
             set { this.autoResetMIPSolve = value; }
         }
+
+        /// <summary>
+        /// Gets or sets the algorithm used for solving LPs (Default).
+        /// Note, this does not affect MIP solves.
+        /// </summary>
+        public LPAlgorithm LPAlgorithm
+        {
+            get { return this.lpAlgorithm; }
+            set { this.lpAlgorithm = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the Clp options (algorithm, presolve, crash, idiot, sprint, etc.) for initial LP solves (null).
+        /// If not null, then with the Default LPAlgorithm, LPs are solved via ClpSimplex.initialSolve(ClpSolveOptions),
+        /// instead of OsiSolver.initialSolve(). Resolves are not affected.
+        /// Only supported for OsiClp and OsiCbc (with Clp); otherwise this is ignored.
+        /// </summary>
+        public ClpSolve ClpSolveOptions
+        {
+            get { return this.clpSolveOptions; }
+            set { this.clpSolveOptions = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the Cholesky factorization used by the barrier (Native).
+        /// Only used if LPAlgorithm is Barrier.
+        /// </summary>
+        public ClpCholeskyType BarrierCholesky
+        {
+            get { return this.barrierCholesky; }
+            set { this.barrierCholesky = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets whether the barrier solution is moved to a basic solution (crossover) by the primal simplex (true).
+        /// Without crossover, there is no basis, and hence no warm start for resolves. For QP, crossover is never done.
+        /// Only used if LPAlgorithm is Barrier.
+        /// </summary>
+        public bool BarrierCrossover
+        {
+            get { return this.barrierCrossover; }
+            set { this.barrierCrossover = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the preprocessing of MIPs (None). If not None, then MIPs are preprocessed with CglPreProcess, 
+        /// solved via CbcModel.branchAndBound on the preprocessed model, and the solution is postprocessed to the original model.
+        /// The CbcSolverArgs are then not used.
+        /// Only supported for OsiCbc, and not for quadratic objectives; otherwise this is ignored.
+        /// </summary>
+        public MIPPreProcess MIPPreProcess
+        {
+            get { return this.mipPreProcess; }
+            set { this.mipPreProcess = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the number of presolve passes of the MIP preprocessing (5).
+        /// Only used if MIPPreProcess is not None.
+        /// </summary>
+        public int MIPPreProcessPasses
+        {
+            get { return this.mipPreProcessPasses; }
+            set { this.mipPreProcessPasses = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of seconds of a MIP solve (null, the Cbc default: no limit).
+        /// Once reached, the best solution found so far (if any) is returned.
+        /// Only supported for OsiCbc; otherwise this is ignored.
+        /// </summary>
+        public double? MIPMaximumSeconds
+        {
+            get { return this.mipMaximumSeconds; }
+            set { this.mipMaximumSeconds = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of nodes of a MIP solve (null, the Cbc default: no limit).
+        /// Only supported for OsiCbc; otherwise this is ignored.
+        /// </summary>
+        public int? MIPMaximumNodes
+        {
+            get { return this.mipMaximumNodes; }
+            set { this.mipMaximumNodes = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of solutions of a MIP solve (null, the Cbc default: no limit).
+        /// Only supported for OsiCbc; otherwise this is ignored.
+        /// </summary>
+        public int? MIPMaximumSolutions
+        {
+            get { return this.mipMaximumSolutions; }
+            set { this.mipMaximumSolutions = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the absolute gap between the best solution and the best possible objective value,
+        /// at which a MIP solve stops (null, the Cbc default).
+        /// Only supported for OsiCbc; otherwise this is ignored.
+        /// </summary>
+        public double? MIPAllowableGap
+        {
+            get { return this.mipAllowableGap; }
+            set { this.mipAllowableGap = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the relative gap (fraction of the objective value of the best solution) between the best solution 
+        /// and the best possible objective value, at which a MIP solve stops (null, the Cbc default). For example, 0.01 for 1%.
+        /// Only supported for OsiCbc; otherwise this is ignored.
+        /// </summary>
+        public double? MIPAllowableFractionGap
+        {
+            get { return this.mipAllowableFractionGap; }
+            set { this.mipAllowableFractionGap = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the cutoff of a MIP solve, in the sense of the objective (null: no cutoff).
+        /// Only solutions better than the cutoff are searched for, so if no such solution exists, the MIP is reported infeasible.
+        /// Only supported for OsiCbc; otherwise this is ignored.
+        /// </summary>
+        public double? MIPCutoff
+        {
+            get { return this.mipCutoff; }
+            set { this.mipCutoff = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets whether the current solution of this solver is used as MIP start of the next MIP solve, if it has a solution 
+        /// and no MIP start is set (false). For a sequence of related MIPs, the previous solution is then checked for feasibility 
+        /// in the changed model, and if feasible, gives the incumbent and a valid cutoff. With MIPPreProcess, only the cutoff is used.
+        /// Only supported for OsiCbc and linear objectives; otherwise this is ignored.
+        /// </summary>
+        public bool MIPCutoffFromSolution
+        {
+            get { return this.mipCutoffFromSolution; }
+            set { this.mipCutoffFromSolution = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets whether the granularity of the objective is detected before a MIP solve (false): if only integer variables 
+        /// have nonzero objective coefficients, and these are multiples of a common value, then objective values of solutions differ 
+        /// by multiples of that value. The Cbc cutoff increment is then set just below it, so that nodes are pruned earlier 
+        /// (see CbcModel.analyzeObjective).
+        /// Only supported for OsiCbc; otherwise this is ignored.
+        /// </summary>
+        public bool MIPObjectiveGranularity
+        {
+            get { return this.mipObjectiveGranularity; }
+            set { this.mipObjectiveGranularity = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets whether integer variables are fixed by their reduced costs before the branch and bound (false), if a cutoff 
+        /// is known: from MIPCutoff, a MIP start or MIPCutoffFromSolution. After the LP relaxation is solved, an integer variable at 
+        /// a bound whose reduced cost exceeds the gap between the cutoff and the LP objective value is fixed at that bound.
+        /// The fixings are undone after the solve if AutoResetMIPSolve. 
+        /// Only supported for OsiCbc; otherwise this is ignored.
+        /// </summary>
+        public bool MIPReducedCostFixing
+        {
+            get { return this.mipReducedCostFixing; }
+            set { this.mipReducedCostFixing = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the node selection of the branch and bound of MIPs (Default).
+        /// Only supported for OsiCbc; otherwise this is ignored.
+        /// </summary>
+        public MIPNodeSelection MIPNodeSelection
+        {
+            get { return this.mipNodeSelection; }
+            set { this.mipNodeSelection = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum depth of the depth-first dives of the Hybrid node selection (int.MaxValue, no maximum).
+        /// Beyond this depth, nodes are selected by best-bound.
+        /// Only used if MIPNodeSelection is Hybrid.
+        /// </summary>
+        public int HybridMaximumDiveDepth
+        {
+            get { return this.hybridMaximumDiveDepth; }
+            set { this.hybridMaximumDiveDepth = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the number of nodes after which the Hybrid node selection switches to best-bound, 
+        /// even if no solution was found yet (0, no limit). Cbc checks the limit every 1000 nodes, so the limit used is 
+        /// rounded up to a multiple of 1000 (see CbcCompareHybridDive.getDiveNodeLimit).
+        /// Only used if MIPNodeSelection is Hybrid.
+        /// </summary>
+        public int HybridDiveNodeLimit
+        {
+            get { return this.hybridDiveNodeLimit; }
+            set { this.hybridDiveNodeLimit = value; }
+        }
+
+        /// <summary>
+        /// Sets a MIP start for the next MIP solve: the given values of variables. Variables without a given value 
+        /// take their current value if this solver has a solution, and 0 otherwise.
+        /// Before the branch and bound, the start is checked for feasibility (with the given tolerance), and if feasible, 
+        /// it is installed as the incumbent and its objective value as the cutoff. Otherwise, the start is ignored.
+        /// The start is only used by the next MIP solve. Only supported for OsiCbc and linear objectives; otherwise this is ignored.
+        /// </summary>
+        /// <param name="values">The values of the variables.</param>
+        /// <param name="tolerance">The feasibility tolerance.</param>
+        public void SetMIPStart(IEnumerable<KeyValuePair<Variable, double>> values, double tolerance = 1e-6)
+        {
+            Ensure.NotNull(values, "values");
+
+            Generate();
+
+            double[] start = new double[variables.Count];
+            if (HasMIPStartSolution())
+            {
+                foreach (Variable var in variables) start[var.Offset] = var.Value;
+            }
+
+            foreach (KeyValuePair<Variable, double> value in values)
+            {
+                start[Offset(value.Key)] = value.Value;
+            }
+
+            mipStart = start;
+            mipStartTolerance = tolerance;
+        }
+
+        /// <summary>
+        /// Sets the current solution of this solver as MIP start for the next MIP solve, for example, to resolve after changing the model.
+        /// </summary>
+        /// <param name="tolerance">The feasibility tolerance.</param>
+        public void SetMIPStart(double tolerance = 1e-6)
+        {
+            if (!HasMIPStartSolution()) throw new SonnetException("Cannot use the current solution as MIP start, since there is no solution.");
+
+            SetMIPStart(new KeyValuePair<Variable, double>[0], tolerance);
+        }
+
+        /// <summary>
+        /// Removes the MIP start, if any.
+        /// </summary>
+        public void ClearMIPStart()
+        {
+            mipStart = null;
+        }
+
+        /// <summary>
+        /// Gets whether a MIP start is set for the next MIP solve.
+        /// </summary>
+        public bool HasMIPStart
+        {
+            get { return mipStart != null; }
+        }
+
+        /// <summary>
+        /// Gets whether the MIP start of the last MIP solve was feasible and used.
+        /// </summary>
+        public bool IsMIPStartAccepted
+        {
+            get { return isMIPStartAccepted; }
+        }
+
+        /// <summary>
+        /// Returns the pseudocosts learned by the branch and bound of the last MIP solve, of the integer variables that were branched on,
+        /// or null if none were learned. Pseudocosts are only learned via CbcModel.branchAndBound, that is, for OsiCbc with the 
+        /// CbcSolverArgs "-branchAndBound" and without MIPPreProcess.
+        /// </summary>
+        /// <returns>The learned pseudocosts, or null.</returns>
+        public PseudoCosts GetPseudoCosts()
+        {
+            return pseudoCosts;
+        }
+
+        /// <summary>
+        /// Sets the pseudocosts for the next MIP solve, for example, learned by a previous solve of a similar model.
+        /// Variables of this solver are matched by reference, and other variables by name. Pseudocosts of other variables are ignored.
+        /// A variable that was branched on at least CbcModel.numberBeforeTrust times is trusted at once, without strong branching.
+        /// The pseudocosts are only used by the next MIP solve, and only via CbcModel.branchAndBound (see GetPseudoCosts); otherwise this is ignored.
+        /// </summary>
+        /// <param name="pseudoCosts">The pseudocosts.</param>
+        public void SetPseudoCosts(PseudoCosts pseudoCosts)
+        {
+            Ensure.NotNull(pseudoCosts, "pseudoCosts");
+
+            Generate();
+
+            int n = variables.Count;
+            double[] downCosts = new double[n];
+            double[] upCosts = new double[n];
+            int[] numberTimesDown = new int[n];
+            int[] numberTimesUp = new int[n];
+
+            Dictionary<string, Variable> variablesByName = null;
+            for (int i = 0; i < pseudoCosts.Count; i++)
+            {
+                Variable variable = pseudoCosts.Variables[i];
+                if (variable == null) continue;
+
+                if (!variable.IsRegistered(this))
+                {
+                    if (variablesByName == null)
+                    {
+                        variablesByName = new Dictionary<string, Variable>();
+                        foreach (Variable other in variables)
+                        {
+                            if (!variablesByName.ContainsKey(other.Name)) variablesByName.Add(other.Name, other);
+                        }
+                    }
+
+                    if (!variablesByName.TryGetValue(variable.Name, out variable)) continue;
+                }
+
+                int j = Offset(variable);
+                downCosts[j] = pseudoCosts.DownCosts[i];
+                upCosts[j] = pseudoCosts.UpCosts[i];
+                numberTimesDown[j] = pseudoCosts.NumberTimesDown[i];
+                numberTimesUp[j] = pseudoCosts.NumberTimesUp[i];
+            }
+
+            pseudoCostsStart = new PseudoCosts(variables.ToArray(), downCosts, upCosts, numberTimesDown, numberTimesUp);
+        }
+
+        /// <summary>
+        /// Removes the pseudocosts for the next MIP solve, if any.
+        /// </summary>
+        public void ClearPseudoCosts()
+        {
+            pseudoCostsStart = null;
+        }
+
+        /// <summary>
+        /// Gets whether pseudocosts are set for the next MIP solve.
+        /// </summary>
+        public bool HasPseudoCosts
+        {
+            get { return pseudoCostsStart != null; }
+        }
+
+        /// <summary>
+        /// Returns the globally valid cuts of the last MIP solve as a packed row block: the cuts at the end of the root 
+        /// and the global cut pool, or null if there were none. The columns of the cuts are the offsets of the variables.
+        /// Cuts are only kept via CbcModel.branchAndBound, that is, for OsiCbc with the CbcSolverArgs "-branchAndBound" and without MIPPreProcess.
+        /// </summary>
+        /// <returns>The cuts, or null.</returns>
+        public CbcCutPool GetCuts()
+        {
+            return cutPool;
+        }
+
+        /// <summary>
+        /// Sets cuts for the next MIP solve, for example the cuts of a previous solve of the same or a tightened model, 
+        /// to save most of the cut generation at the root. The cuts are added as a cut pool of the branch and bound (not as rows), 
+        /// from which the violated cuts are added at each node. The pool is removed again afterwards (if AutoResetMIPSolve). 
+        /// The cuts must be valid for the model.
+        /// If purgeNotTight, only the cuts that were tight at the solution of the previous solve are used.
+        /// The cuts are only used by the next MIP solve, and only via CbcModel.branchAndBound (see GetCuts); otherwise this is ignored.
+        /// </summary>
+        /// <param name="cuts">The cuts.</param>
+        /// <param name="purgeNotTight">Whether to purge the cuts that were not tight.</param>
+        /// <param name="tolerance">The tolerance for a cut to be tight.</param>
+        public void SetCuts(CbcCutPool cuts, bool purgeNotTight = false, double tolerance = 1e-6)
+        {
+            Ensure.NotNull(cuts, "cuts");
+
+            cutPoolStart = cuts;
+            cutPoolPurgeNotTight = purgeNotTight;
+            cutPoolTolerance = tolerance;
+        }
+
+        /// <summary>
+        /// Removes the cuts for the next MIP solve, if any.
+        /// </summary>
+        public void ClearCuts()
+        {
+            cutPoolStart = null;
+        }
+
+        /// <summary>
+        /// Gets whether cuts are set for the next MIP solve.
+        /// </summary>
+        public bool HasCuts
+        {
+            get { return cutPoolStart != null; }
+        }
+
+        /// <summary>
+        /// Adds the given cut generator to every subsequent MIP solve (OsiCbc), for example a CglManagedCutGenerator for lazy constraints.
+        /// The reset after a MIP solve (if AutoResetMIPSolve) removes the cut generators of the Cbc model, so a generator added directly 
+        /// via CbcModel.addCutGenerator only lasts one solve, whereas a generator added here is added again for each MIP solve.
+        /// The Cbc model stores a copy, so keep the generator alive (and not disposed) until it is removed via ClearCutGenerators.
+        /// With MIPPreProcess, the generator is used on the preprocessed model, whose columns differ from the variables of the model.
+        /// </summary>
+        /// <param name="generator">The cut generator.</param>
+        /// <param name="howOften">How often to call the generator: 1 at every node, k > 1 every k nodes, -99 only at the root (see CbcModel.addCutGenerator).</param>
+        /// <param name="name">The name of the generator in the log.</param>
+        /// <param name="normal">Whether to call the generator at the nodes.</param>
+        /// <param name="atSolution">Whether to call the generator at solutions, e.g., for lazy constraints.</param>
+        /// <param name="infeasible">Whether to call the generator when a node is infeasible.</param>
+        public void AddCutGenerator(CglCutGenerator generator, int howOften = 1, string name = null, bool normal = true, bool atSolution = false, bool infeasible = false)
+        {
+            Ensure.NotNull(generator, "generator");
+
+            cutGenerators.Add(new CutGeneratorEntry(generator, howOften, name, normal, atSolution, infeasible));
+        }
+
+        /// <summary>
+        /// Removes the cut generators added via AddCutGenerator from the subsequent MIP solves.
+        /// </summary>
+        public void ClearCutGenerators()
+        {
+            cutGenerators.Clear();
+        }
+
+        /// <summary>
+        /// Gets whether cut generators were added via AddCutGenerator.
+        /// </summary>
+        public bool HasCutGenerators
+        {
+            get { return cutGenerators.Count > 0; }
+        }
         
         #region OsiSolver Properties and Parameters
         /// <summary>
@@ -184,227 +692,1393 @@ namespace Sonnet
         }
         #endregion
 
-        /// <summary>
-        /// Get the model of the current solver
-        /// </summary>
-        public Model Model
-        {
-            get { return this.model; }
+        /// <summary>
+        /// Get the model of the current solver
+        /// </summary>
+        public Model Model
+        {
+            get { return this.model; }
+        }
+
+        /// <summary>
+        /// Get the used OsiSolver
+        /// </summary>
+        public OsiSolverInterface OsiSolver
+        {
+            get { return this.solver; }
+        }
+
+        /// <summary>
+        /// Get the full name of the type of OsiSolver.
+        /// For example, "COIN.OsiClpSolverInterface"
+        /// </summary>
+        public string OsiSolverFullName
+        {
+            get { return this.solver.GetType().FullName; }
+        }
+
+        #region Get Model propeties
+        /// <summary>
+        /// Get whether this model was already generated (at least) once before.
+        /// Note, if alterations have been made after the last solve (Generate), then still this will return true.
+        /// </summary>
+        protected bool Generated
+        {
+            get { return generated; }
+        }
+
+        #endregion
+
+        internal void ApplyObjective(Objective objective)
+        {
+            Ensure.NotNull(objective, "objective");
+            Ensure.NotNull(this.objective, "this.objective");
+            // this method should ONLY be called FROM the model
+
+            DiscardPresolved();
+            if (Generated)
+            {
+                this.objective.Unregister(this);
+                this.objective = objective;
+                Generate(this.objective);
+            }
+            else
+            {
+                this.objective = objective;
+            }
+        }
+
+        internal void ApplyObjectiveSense(ObjectiveSense sense)
+        {
+            DiscardPresolved();
+
+            // (1 for min (default), -1 for max)
+            switch (sense)
+            {
+                case ObjectiveSense.Maximise:
+                    solver.setObjSense(-1.0);
+                    break;
+                case ObjectiveSense.Minimise:
+                    solver.setObjSense(1.0);
+                    break;
+                default:
+                    throw new ArgumentOutOfRangeException("Unknown objective function sense : " + sense);
+            }
+        }
+
+        /// <summary>
+        /// Adds (a reference) the given constraint to the model
+        /// </summary>
+        /// <param name="con">The constraint to add to the model.</param>
+        internal void Add(Constraint con)
+        {
+            Ensure.NotNull(con, "con");
+
+            rawconstraints.Add(con);
+        }
+
+        #region Solve, Resolve, Maximise and Minimise Methods
+        ///<summary>
+        /// Maximises the model.
+        /// This implicitly sets the objective sense to Maximise.
+        /// The method uses branch and bound if model is MIP and LP otherwise.
+        /// </summary>
+        /// <param name="forceRelaxation">Force solving of the LP relaxation</param>
+        public void Maximise(bool forceRelaxation = false)
+        {
+            ApplyObjectiveSense(ObjectiveSense.Maximise);
+            if (!Generated) Solve(forceRelaxation);
+            else Resolve(forceRelaxation);
+        }
+
+        ///<summary>
+        /// Minimises the model.
+        /// This implicitly sets the objective sense to Minimise.
+        /// The method uses branch and bound if model is MIP and LP otherwise.
+        /// </summary>
+        /// <param name="forceRelaxation">Force solving of the LP relaxation.</param>
+        public void Minimise(bool forceRelaxation = false)
+        {
+            ApplyObjectiveSense(ObjectiveSense.Minimise);
+            if (!Generated) Solve(forceRelaxation);
+            else Resolve(forceRelaxation);
+        }
+
+        /// <summary>
+        /// Solve the model according to the ObjectiveSense settings.
+        /// The method uses branch and bound if model is MIP and LP otherwise.
+        /// </summary>
+        /// <param name="forceRelaxation">Force solving of the LP relaxation.</param>
+        public void Solve(bool forceRelaxation = false)
+        {
+            Solve(false, forceRelaxation);
+        }
+
+        /// <summary>
+        /// Resolve the model according to the ObjectiveSense settings.
+        /// The method uses branch and bound if model is MIP and LP otherwise.
+        /// </summary>
+        /// <param name="forceRelaxation">Force solving of the LP relaxation.</param>
+        public void Resolve(bool forceRelaxation = false)
+        {
+            Solve(true, forceRelaxation);
+        }
+
+        private void Solve(bool doResolve, bool forceRelaxation)
+        {
+            if (doResolve)
+            {
+                if (!Generated) throw new SonnetException("Cannot Resolve a model that hasn't been generated yet.");
+            }
+
+            double genStart = CoinUtils.CoinCpuTime();
+
+            // Note: always call Generate!
+            Generate();
+
+            bool isMIPSolve = forceRelaxation == false && IsMIP;
+            CbcModel telemetryCbcModel = (isMIPSolve && solver is OsiCbcSolverInterface) ? ((OsiCbcSolverInterface)solver).getModelPtr() : null;
+            if (collectTelemetry)
+            {
+                telemetry = new SolveTelemetry(isMIPSolve, objective.Constant);
+                telemetry.generateSeconds = CoinUtils.CoinCpuTime() - genStart;
+            }
+            else telemetry = null;
+
+            try
+            {
+                if (telemetry != null && telemetryCbcModel != null) telemetry.Attach(telemetryCbcModel, telemetryNodeInterval);
+                BeginCancellable();
+                double solveStart = CoinUtils.CoinCpuTime();
+
+                if (isMIPSolve)
+                {
+                    if (objective.IsQuadratic)
+                    {
+                        log.Warn("Only experimantal support for MIQP!");
+                    }
+
+                    if (mipCutoffFromSolution && mipStart == null && HasMIPStartSolution()) SetMIPStart(mipStartTolerance);
+
+                    isSolving = true;
+                    DiscardPresolved(); // branch and bound changes the bounds, and OsiCbc may even replace its solver
+                    // the state to reset to after the solve is saved per path, since via CbcMain it is saved after the setup by CbcMain0
+                    isMIPStartAccepted = false;
+                    pseudoCosts = null;
+                    cutPool = null;
+
+                    if (solver is OsiCbcSolverInterface)
+                    {
+                        OsiCbcSolverInterface cbcSolver = (OsiCbcSolverInterface)solver;
+                        #warning "SONNET: Clean this code. Experimental only."
+                        if (!objective.IsQuadratic && mipPreProcess != MIPPreProcess.None)
+                        {
+                            if (AutoResetMIPSolve) SaveBeforeMIPSolveInternal();
+                            ApplyMIPLimits(cbcSolver.getModelPtr(), solver.getObjSense());
+                            ApplyObjectiveGranularity(cbcSolver.getModelPtr());
+                            // the preprocessed model has other columns, so only the cutoff of the start can be used
+                            ApplyMIPStart(cbcSolver.getModelPtr(), true);
+                            ApplyReducedCostFixing(cbcSolver.getModelPtr());
+                            if (HasBranchingPreferences()) log.Warn("Branching priorities, directions and special ordered sets are ignored with MIPPreProcess.");
+                            if (HasPseudoCosts) log.Warn("Pseudocosts are ignored with MIPPreProcess.");
+                            if (HasCuts) log.Warn("Cuts are ignored with MIPPreProcess.");
+                            ApplyNodeSelection(cbcSolver.getModelPtr());
+                            ApplyCutGenerators(cbcSolver.getModelPtr());
+                            BranchAndBoundPreProcessed(cbcSolver);
+                        }
+                        else if (!objective.IsQuadratic && cbcSolver.UseBranchAndBound())
+                        {
+                            if (AutoResetMIPSolve) SaveBeforeMIPSolveInternal();
+                            ApplyMIPLimits(cbcSolver.getModelPtr(), solver.getObjSense());
+                            ApplyObjectiveGranularity(cbcSolver.getModelPtr());
+                            ApplyMIPStart(cbcSolver.getModelPtr(), false);
+                            ApplyReducedCostFixing(cbcSolver.getModelPtr());
+                            ApplyBranchingObjects(cbcSolver.getModelPtr());
+                            ApplyNodeSelection(cbcSolver.getModelPtr());
+                            ApplyCutGenerators(cbcSolver.getModelPtr());
+                            ApplyPseudoCosts(cbcSolver.getModelPtr());
+                            ApplyCuts(cbcSolver.getModelPtr());
+                            if (telemetry != null) SolveRootLP(cbcSolver.getModelPtr());
+                            // Cbc removes the root cuts from the solver during the tree search, so they are recorded at the end of the root
+                            cutPool = cbcSolver.getModelPtr().branchAndBoundGetCuts(0);
+                            if (cutPool.numberCuts() == 0) cutPool = null;
+                            pseudoCosts = ExtractPseudoCosts(cbcSolver.getModelPtr());
+                            //cbcSolver.branchAndBound(); // this somehow DOESNT work (wrong obj value) if Quadratic
+                        }
+                        else
+                        {
+                            string[] cbcMainArgs = cbcSolver.GetCbcSolverArgs();
+                            List<string> args = new List<string>();
+                            args.Add("Sonnet");
+                            if (cbcSolver.UseBranchAndBound())
+                            {
+                                AddMIPLimitArgs(args);
+                                args.Add("-solve");
+                                //args.Add("-solution");
+                                //args.Add("out.txt");
+                            }
+                            else
+                            { 
+                                args.AddRange(cbcMainArgs);
+                                AddMIPLimitArgs(args);
+                                args.Add("-solve");
+                            }
+                            args.Add("-quit");
+
+                            // the setup of CbcMain0 is reused for repeated solves of the same model with the same arguments
+                            if (cbcSolverSession == null) cbcSolverSession = new CbcSolverSession();
+                            cbcSolverSession.prepare(args.ToArray(), cbcSolver.getModelPtr());
+                            // the reset after the solve restores the model as set up by CbcMain0, which the reused setup expects
+                            if (AutoResetMIPSolve) SaveBeforeMIPSolveInternal();
+                            // CbcMain1 copies the incumbent and the cutoff increment of the model into its branch and bound model
+                            ApplyObjectiveGranularity(cbcSolver.getModelPtr());
+                            ApplyMIPStart(cbcSolver.getModelPtr(), false);
+                            ApplyReducedCostFixing(cbcSolver.getModelPtr());
+                            ApplyBranchingObjects(cbcSolver.getModelPtr());
+                            ApplyNodeSelection(cbcSolver.getModelPtr());
+                            ApplyCutGenerators(cbcSolver.getModelPtr());
+                            if (HasPseudoCosts) log.Warn("Pseudocosts are only used via CbcModel.branchAndBound, with the CbcSolverArgs -branchAndBound.");
+                            if (HasCuts) log.Warn("Cuts are only used via CbcModel.branchAndBound, with the CbcSolverArgs -branchAndBound.");
+                            cbcSolverSession.CbcMain1();
+                        }
+                    }
+                    else
+                    {
+                        if (AutoResetMIPSolve) SaveBeforeMIPSolveInternal();
+                        if (HasBranchingPreferences()) log.Warn("Branching priorities, directions and special ordered sets are only supported for OsiCbc.");
+                        if (mipNodeSelection != MIPNodeSelection.Default) log.Warn("MIPNodeSelection is only supported for OsiCbc.");
+                        if (HasPseudoCosts) log.Warn("Pseudocosts are only supported for OsiCbc.");
+                        if (HasCuts) log.Warn("Cuts are only supported for OsiCbc.");
+                        if (HasCutGenerators) log.Warn("Cut generators are only supported for OsiCbc.");
+                        solver.branchAndBound();
+                    }
+                    mipStart = null;
+                    pseudoCostsStart = null;
+                    cutPoolStart = null;
+
+
+                    double assignStart = CoinUtils.CoinCpuTime();
+                    AssignSolution(true);
+                    // the reset clears the counts of the Cbc model, so the telemetry reads them before
+                    if (telemetry != null)
+                    {
+                        RecordTelemetryTimes(solveStart, assignStart, telemetryCbcModel);
+                        telemetry.Detach(telemetryCbcModel);
+                    }
+                    if (AutoResetMIPSolve) ResetAfterMIPSolveInternal(); // mainly to reset bounds etc, but use AssignSolutionStatus because the Reset messes up the IsProvenOptimal etc!
+                }
+                else
+                {
+                    isSolving = true;
+                    OsiClpSolverInterface osiClp = GetOsiClpSolver();
+                    if (usePresolve && lpAlgorithm == LPAlgorithm.Default && osiClp != null && !objective.IsQuadratic && SolvePresolved(osiClp))
+                    {
+                        // solved and postsolved into the original model
+                    }
+                    else if (lpAlgorithm == LPAlgorithm.Race && osiClp != null && !objective.IsQuadratic)
+                    {
+                        ClpRaceAlgorithms winner = osiClp.race(ClpRaceAlgorithms.All, stopFlag);
+                        log.InfoFormat("LP race won by {0}", winner);
+                    }
+                    else if (lpAlgorithm == LPAlgorithm.Barrier && osiClp != null)
+                    {
+                        int status = osiClp.getModelPtr().barrier(barrierCrossover, barrierCholesky);
+                        log.InfoFormat("Barrier finished with status {0}", status);
+                    }
+                    else if (!doResolve && clpSolveOptions != null && osiClp != null)
+                    {
+                        int status = osiClp.getModelPtr().initialSolve(clpSolveOptions);
+                        log.InfoFormat("Clp initialSolve with options finished with status {0}", status);
+                    }
+                    else if (doResolve) solver.resolve();
+                    else solver.initialSolve();
+
+                    double assignStart = CoinUtils.CoinCpuTime();
+                    AssignSolution(false);
+                    if (telemetry != null) RecordTelemetryTimes(solveStart, assignStart, null);
+                }
+            }
+            catch (Exception e)
+            {
+                log.Error(e.ToString());
+                throw;
+            }
+            finally
+            {
+                EndCancellable();
+                if (telemetry != null) telemetry.Detach(telemetryCbcModel);
+                isSolving = false;
+            }
+
+            if (isCancelled) log.Info("The solve was cancelled.");
+            log.InfoFormat(" IsAbandoned: {0}", IsAbandoned);
+            log.InfoFormat(" IsProvenOptimal: {0}", IsProvenOptimal);
+            log.InfoFormat(" IsProvenDualInfeasible: {0}", IsProvenDualInfeasible);
+            log.InfoFormat(" IsProvenPrimalInfeasible: {0}", IsProvenPrimalInfeasible);
+            log.InfoFormat(" IsPrimalObjectiveLimitReached: {0}", IsPrimalObjectiveLimitReached);
+            log.InfoFormat(" IsDualObjectiveLimitReached: {0}", IsDualObjectiveLimitReached);
+
+            log.InfoFormat("Done resolving after {0}", (CoinUtils.CoinCpuTime() - genStart));
+        }
+
+        /// <summary>
+        /// Preprocesses the MIP with CglPreProcess according to MIPPreProcess, and solves the preprocessed MIP
+        /// using branch and bound. The solution is postprocessed into the solver of the Cbc model.
+        /// </summary>
+        private void BranchAndBoundPreProcessed(OsiCbcSolverInterface cbcSolver)
+        {
+            CglPreProcess process = new CglPreProcess();
+            try
+            {
+                CglPreProcessOptions options = CglPreProcessOptions.None;
+                if ((mipPreProcess & (MIPPreProcess.Probing | MIPPreProcess.CoefficientTightening)) != 0)
+                {
+                    // as CbcMain: probing with the objective, mainly at the root
+                    CglProbing probing = new CglProbing();
+                    probing.setUsingObjective(1);
+                    probing.setMaxPass(1);
+                    probing.setMaxPassRoot(1);
+                    probing.setMaxProbeRoot(100);
+                    probing.setMaxElements(100);
+                    probing.setMaxLookRoot(50);
+                    // rowCuts: 1 for disaggregation cuts, 2 for coefficient tightening
+                    int rowCuts = 0;
+                    if ((mipPreProcess & MIPPreProcess.Probing) != 0) rowCuts |= 1;
+                    if ((mipPreProcess & MIPPreProcess.CoefficientTightening) != 0) rowCuts |= 2;
+                    probing.setRowCuts(rowCuts);
+                    process.addCutGenerator(probing);
+                }
+                else options |= CglPreProcessOptions.NoProbing;
+
+                if ((mipPreProcess & MIPPreProcess.Cliques) == 0) options |= CglPreProcessOptions.NoCliques;
+                if ((mipPreProcess & MIPPreProcess.DuplicateRows) == 0) options |= CglPreProcessOptions.NoDuplicateRows;
+                process.setOptions(options);
+
+                if (!cbcSolver.getModelPtr().branchAndBound(process, 0, mipPreProcessPasses, 0, 0))
+                {
+                    log.Info("MIP preprocessing found the problem to be infeasible.");
+                }
+            }
+            finally
+            {
+                process.Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Resets the stop flag and installs it on the Clp and Cbc models of the solver. 
+        /// Starts the timer for the TimeLimit, and registers Cancel on the CancellationToken, if any.
+        /// </summary>
+        private void BeginCancellable()
+        {
+            stopFlag.reset();
+            isCancelled = false;
+
+            OsiClpSolverInterface osiClp = GetOsiClpSolver();
+            if (osiClp != null) osiClp.getModelPtr().passInStopFlag(stopFlag);
+            if (solver is OsiCbcSolverInterface)
+            {
+                CbcModel cbcModel = ((OsiCbcSolverInterface)solver).getModelPtr();
+                cbcModel.passInStopFlag(stopFlag);
+                solvingCbcModel = cbcModel;
+            }
+
+            if (cancellationToken.CanBeCanceled) cancellationRegistration = cancellationToken.Register(Cancel);
+            if (timeLimit.HasValue) cancelTimer = new System.Threading.Timer(state => Cancel(), null, timeLimit.Value, TimeSpan.FromMilliseconds(-1));
+        }
+
+        /// <summary>
+        /// Stops the timer and the registration on the CancellationToken, and waits for a running Cancel of either, 
+        /// such that it cannot stop the next solve. Removes the stop flag from the Clp and Cbc models.
+        /// A solve only counts as cancelled if it was stopped before proving its result, so not if Cancel() came after the solve.
+        /// </summary>
+        private void EndCancellable()
+        {
+            if (cancelTimer != null)
+            {
+                using (System.Threading.ManualResetEvent timerDisposed = new System.Threading.ManualResetEvent(false))
+                {
+                    if (cancelTimer.Dispose(timerDisposed)) timerDisposed.WaitOne();
+                }
+                cancelTimer = null;
+            }
+            cancellationRegistration.Dispose(); // waits for a running callback
+            cancellationRegistration = default(System.Threading.CancellationTokenRegistration);
+            solvingCbcModel = null;
+            isCancelled = stopFlag.isStopped() && !isProvenOptimal && !isProvenPrimalInfeasible && !isProvenDualInfeasible;
+
+            // OsiCbc may have replaced its solver during the solve
+            OsiClpSolverInterface osiClp = GetOsiClpSolver();
+            if (osiClp != null) osiClp.getModelPtr().passInStopFlag(null);
+            if (solver is OsiCbcSolverInterface) ((OsiCbcSolverInterface)solver).getModelPtr().passInStopFlag(null);
+        }
+
+        /// <summary>
+        /// Solves the root LP relaxation of the Cbc model before the branch and bound, to record its time in the telemetry.
+        /// Cbc raises no event at the end of the root LP, so its time cannot be taken from the event stream, unlike RootSeconds.
+        /// Only used when telemetry is collected: the branch and bound then starts from the solved root LP instead of solving it itself.
+        /// </summary>
+        private void SolveRootLP(CbcModel cbcModel)
+        {
+            double start = CoinUtils.CoinCpuTime();
+            cbcModel.initialSolve();
+            telemetry.rootLPSeconds = CoinUtils.CoinCpuTime() - start;
+        }
+
+        /// <summary>
+        /// Records the solve and assign times and the number of iterations in the telemetry.
+        /// </summary>
+        private void RecordTelemetryTimes(double solveStart, double assignStart, CbcModel cbcModel)
+        {
+            telemetry.solveSeconds = assignStart - solveStart;
+            telemetry.assignSeconds = CoinUtils.CoinCpuTime() - assignStart;
+            telemetry.iterationCount = (cbcModel != null) ? cbcModel.getIterationCount() : iterationCount;
+        }
+
+        /// <summary>
+        /// Returns the maximum number of seconds of a MIP solve: the smallest of MIPMaximumSeconds and TimeLimit, or null if neither is set.
+        /// </summary>
+        private double? GetMIPMaximumSeconds()
+        {
+            if (!timeLimit.HasValue) return mipMaximumSeconds;
+            if (!mipMaximumSeconds.HasValue) return timeLimit.Value.TotalSeconds;
+            return Math.Min(mipMaximumSeconds.Value, timeLimit.Value.TotalSeconds);
+        }
+
+        /// <summary>
+        /// Sets the MIP limits that are not null on the given Cbc model, for branch and bound.
+        /// The objective sense is passed in, since the scenario workers must not touch the solver itself.
+        /// </summary>
+        private void ApplyMIPLimits(CbcModel cbcModel, double objSense)
+        {
+            double? maximumSeconds = GetMIPMaximumSeconds();
+            if (maximumSeconds.HasValue) cbcModel.setMaximumSeconds(maximumSeconds.Value);
+            if (mipMaximumNodes.HasValue) cbcModel.setMaximumNodes(mipMaximumNodes.Value);
+            if (mipMaximumSolutions.HasValue) cbcModel.setMaximumSolutions(mipMaximumSolutions.Value);
+            if (mipAllowableGap.HasValue) cbcModel.setAllowableGap(mipAllowableGap.Value);
+            if (mipAllowableFractionGap.HasValue) cbcModel.setAllowableFractionGap(mipAllowableFractionGap.Value);
+            // the Cbc cutoff is as minimization
+            if (mipCutoff.HasValue) cbcModel.setCutoff(mipCutoff.Value * objSense);
+        }
+
+        /// <summary>
+        /// If MIPObjectiveGranularity, sets the cutoff increment of the given Cbc model just below the granularity of the objective, if any,
+        /// and if larger than the current increment, via the analysis of Cbc.
+        /// </summary>
+        private void ApplyObjectiveGranularity(CbcModel cbcModel)
+        {
+            if (!mipObjectiveGranularity) return;
+
+            double increment = cbcModel.getCutoffIncrement();
+            cbcModel.analyzeObjective();
+            if (cbcModel.getCutoffIncrement() != increment) log.DebugFormat("Objective granularity: cutoff increment set to {0}.", cbcModel.getCutoffIncrement());
+        }
+
+        /// <summary>
+        /// If MIPReducedCostFixing, fixes integer variables of the given Cbc model by their reduced costs, using the cutoff of the model 
+        /// or MIPCutoff. The fixings are bound changes, so the reset after the MIP solve undoes them.
+        /// </summary>
+        private void ApplyReducedCostFixing(CbcModel cbcModel)
+        {
+            if (!mipReducedCostFixing) return;
+            if (objective.IsQuadratic)
+            {
+                log.Warn("Reduced cost fixing is ignored for a quadratic objective.");
+                return;
+            }
+
+            // the MIPCutoff is passed to CbcMain1 as argument, and may not be on the model yet
+            if (mipCutoff.HasValue && mipCutoff.Value * solver.getObjSense() < cbcModel.getCutoff()) cbcModel.setCutoff(mipCutoff.Value * solver.getObjSense());
+
+            int numberFixed = cbcModel.fixOnReducedCosts(1e-6);
+            log.InfoFormat("Reduced cost fixing fixed {0} integer variables.", numberFixed);
+        }
+
+        /// <summary>
+        /// Returns whether any variable has a branching priority or direction, or the model has special ordered sets.
+        /// </summary>
+        private bool HasBranchingPreferences()
+        {
+            return model.NumberOfSOSConstraints > 0 || variables.Exists(var => var.Priority.HasValue || var.BranchDirection != BranchDirection.Default);
+        }
+
+        /// <summary>
+        /// Translates the branching priorities and directions of the variables and the special ordered sets of the model 
+        /// into the objects of the given Cbc model. The objects of a previous solve are removed.
+        /// </summary>
+        private void ApplyBranchingObjects(CbcModel cbcModel)
+        {
+            bool hasSOS = model.NumberOfSOSConstraints > 0;
+            bool hasPriorities = variables.Exists(var => var.Priority.HasValue || var.BranchDirection != BranchDirection.Default);
+            if (!hasSOS && !hasPriorities && !hasBranchingObjects) return;
+
+            // start again from the simple integers only
+            cbcModel.deleteObjects(true);
+            hasBranchingObjects = false;
+
+            if (hasPriorities)
+            {
+                // the default Cbc priority is 1000
+                int[] integerVariable = cbcModel.integerVariable();
+                int[] priorities = integerVariable.Select(j => variables[j].Priority ?? 1000).ToArray();
+                cbcModel.passInPriorities(priorities, false);
+
+                for (int i = 0, n = cbcModel.numberObjects(); i < n; i++)
+                {
+                    CbcSimpleInteger integer = cbcModel.object(i) as CbcSimpleInteger;
+                    if (integer == null) continue;
+
+                    BranchDirection direction = variables[integer.columnNumber()].BranchDirection;
+                    if (direction != BranchDirection.Default) integer.setPreferredWay((direction == BranchDirection.Down) ? -1 : 1);
+                }
+                hasBranchingObjects = true;
+            }
+
+            if (hasSOS)
+            {
+                List<CbcObject> sets = new List<CbcObject>();
+                foreach (SOSConstraint sos in model.SOSConstraints)
+                {
+                    int[] columns = sos.Variables.Select(var => Offset(var)).ToArray();
+                    CbcSOS set = new CbcSOS(cbcModel, columns, sos.Weights, sos.ID, (int)sos.Type);
+                    if (sos.Priority.HasValue) set.setPriority(sos.Priority.Value);
+                    sets.Add(set);
+                }
+
+                // the Cbc model stores copies
+                cbcModel.addObjects(sets.ToArray());
+                foreach (CbcObject set in sets) set.Dispose();
+                hasBranchingObjects = true;
+            }
+        }
+
+        /// <summary>
+        /// Sets the node comparison of the given Cbc model for the MIPNodeSelection. The model stores a copy.
+        /// If the node selection was changed back to Default, the default comparison is installed again.
+        /// </summary>
+        private void ApplyNodeSelection(CbcModel cbcModel)
+        {
+            if (mipNodeSelection == MIPNodeSelection.Default && !hasNodeComparison) return;
+
+            CbcCompareBase compare;
+            switch (mipNodeSelection)
+            {
+                case MIPNodeSelection.DepthFirst:
+                    compare = new CbcCompareDepth();
+                    break;
+                case MIPNodeSelection.BestBound:
+                    compare = new CbcCompareObjective();
+                    break;
+                case MIPNodeSelection.BestEstimate:
+                    compare = new CbcCompareEstimate();
+                    break;
+                case MIPNodeSelection.Hybrid:
+                    CbcCompareHybridDive hybrid = new CbcCompareHybridDive();
+                    hybrid.setMaximumDiveDepth(hybridMaximumDiveDepth);
+                    hybrid.setDiveNodeLimit(hybridDiveNodeLimit);
+                    compare = hybrid;
+                    break;
+                default:
+                    compare = new CbcCompareDefault();
+                    break;
+            }
+
+            // also a new Hybrid comparison starts diving again
+            cbcModel.setNodeComparison(compare);
+            compare.Dispose();
+            hasNodeComparison = mipNodeSelection != MIPNodeSelection.Default;
+        }
+
+        /// <summary>
+        /// Adds the cut generators of AddCutGenerator to the given Cbc model. The model stores a copy of each.
+        /// </summary>
+        private void ApplyCutGenerators(CbcModel cbcModel)
+        {
+            foreach (CutGeneratorEntry entry in cutGenerators)
+            {
+                // the defaults of Cbc for the sub trees and depths
+                cbcModel.addCutGenerator(entry.generator, entry.howOften, entry.name, entry.normal, entry.atSolution, entry.infeasible, -100, -1, -1);
+            }
+        }
+
+        private class CutGeneratorEntry
+        {
+            public CutGeneratorEntry(CglCutGenerator generator, int howOften, string name, bool normal, bool atSolution, bool infeasible)
+            {
+                this.generator = generator;
+                this.howOften = howOften;
+                this.name = name;
+                this.normal = normal;
+                this.atSolution = atSolution;
+                this.infeasible = infeasible;
+            }
+
+            public CglCutGenerator generator;
+            public int howOften;
+            public string name;
+            public bool normal;
+            public bool atSolution;
+            public bool infeasible;
+        }
+
+        /// <summary>
+        /// Sets the pseudocosts for the next MIP solve, if any, on the dynamic pseudocost objects of the given Cbc model.
+        /// </summary>
+        private void ApplyPseudoCosts(CbcModel cbcModel)
+        {
+            if (pseudoCostsStart == null) return;
+
+            int count = cbcModel.setPseudoCosts(pseudoCostsStart.DownCosts, pseudoCostsStart.UpCosts, pseudoCostsStart.NumberTimesDown, pseudoCostsStart.NumberTimesUp);
+            log.DebugFormat("Pseudocosts set of {0} integer variables.", count);
+        }
+
+        /// <summary>
+        /// Adds the cuts for the next MIP solve, if any, as a cut pool to the given Cbc model.
+        /// </summary>
+        private void ApplyCuts(CbcModel cbcModel)
+        {
+            if (cutPoolStart == null) return;
+
+            int count = cbcModel.addCuts(cutPoolStart, cutPoolPurgeNotTight, cutPoolTolerance);
+            log.DebugFormat("Added {0} of {1} cuts.", count, cutPoolStart.numberCuts());
+        }
+
+        /// <summary>
+        /// Returns the pseudocosts of the integer variables that were branched on, learned by the branch and bound of the given Cbc model, or null if none.
+        /// </summary>
+        private PseudoCosts ExtractPseudoCosts(CbcModel cbcModel)
+        {
+            int n = variables.Count;
+            double[] downCosts = new double[n];
+            double[] upCosts = new double[n];
+            int[] numberTimesDown = new int[n];
+            int[] numberTimesUp = new int[n];
+            if (solver.getNumCols() != n || cbcModel.getPseudoCosts(downCosts, upCosts, numberTimesDown, numberTimesUp) == 0) return null;
+
+            List<int> columns = new List<int>();
+            for (int j = 0; j < n; j++)
+            {
+                if (numberTimesDown[j] > 0 || numberTimesUp[j] > 0) columns.Add(j);
+            }
+            if (columns.Count == 0) return null;
+
+            return new PseudoCosts(columns.Select(j => variables[j]).ToArray(), columns.Select(j => downCosts[j]).ToArray(), 
+                columns.Select(j => upCosts[j]).ToArray(), columns.Select(j => numberTimesDown[j]).ToArray(), columns.Select(j => numberTimesUp[j]).ToArray());
+        }
+
+        /// <summary>
+        /// Returns whether the variables of this solver have a solution that can be used for a MIP start.
+        /// </summary>
+        private bool HasMIPStartSolution()
+        {
+            return variables.Count > 0 && variables[0].AssignedSolver == this && (IsProvenOptimal || IsFeasible());
+        }
+
+        /// <summary>
+        /// Checks the MIP start, if any, for feasibility and if feasible, installs it on the given Cbc model as incumbent and cutoff, 
+        /// or only as cutoff.
+        /// </summary>
+        private void ApplyMIPStart(CbcModel cbcModel, bool cutoffOnly)
+        {
+            isMIPStartAccepted = false;
+            if (mipStart == null) return;
+
+            if (objective.IsQuadratic)
+            {
+                log.Warn("The MIP start is ignored for a quadratic objective.");
+                return;
+            }
+
+            isMIPStartAccepted = cbcModel.setMIPStart(mipStart, mipStartTolerance, cutoffOnly);
+            if (isMIPStartAccepted) log.InfoFormat("The MIP start is feasible with objective value {0} and is used{1}.", cbcModel.getCutoff() * solver.getObjSense() + objective.Constant, cutoffOnly ? " as cutoff" : "");
+            else log.Info("The MIP start is not feasible and is ignored.");
+        }
+
+        /// <summary>
+        /// Adds the MIP limits that are not null as arguments for CbcMain1, which resets the limits of the Cbc model.
+        /// </summary>
+        private void AddMIPLimitArgs(List<string> args)
+        {
+            double? maximumSeconds = GetMIPMaximumSeconds();
+            if (maximumSeconds.HasValue) args.AddRange(new string[] { "-seconds", maximumSeconds.Value.ToString("R", CultureInfo.InvariantCulture) });
+            if (mipMaximumNodes.HasValue) args.AddRange(new string[] { "-maxNodes", mipMaximumNodes.Value.ToString(CultureInfo.InvariantCulture) });
+            if (mipMaximumSolutions.HasValue) args.AddRange(new string[] { "-maxSolutions", mipMaximumSolutions.Value.ToString(CultureInfo.InvariantCulture) });
+            if (mipAllowableGap.HasValue) args.AddRange(new string[] { "-allowableGap", mipAllowableGap.Value.ToString("R", CultureInfo.InvariantCulture) });
+            if (mipAllowableFractionGap.HasValue) args.AddRange(new string[] { "-ratioGap", mipAllowableFractionGap.Value.ToString("R", CultureInfo.InvariantCulture) });
+            if (mipCutoff.HasValue) args.AddRange(new string[] { "-cutoff", (mipCutoff.Value * solver.getObjSense()).ToString("R", CultureInfo.InvariantCulture) });
+        }
+
+        /// <summary>
+        /// Returns the OsiClp solver: either the solver itself, or the real solver of OsiCbc if that is OsiClp.
+        /// Returns null otherwise.
+        /// </summary>
+        private OsiClpSolverInterface GetOsiClpSolver()
+        {
+            if (solver is OsiClpSolverInterface) return (OsiClpSolverInterface)solver;
+            if (solver is OsiCbcSolverInterface) return ((OsiCbcSolverInterface)solver).getRealSolverPtr() as OsiClpSolverInterface;
+            return null;
+        }
+        #endregion
+
+        #region Presolve
+        /// <summary>
+        /// Presolves the LP (relaxation) with Clp, and keeps the reduced model and the postsolve information on this solver.
+        /// Subsequent LP solves and resolves solve the reduced model, and postsolve the solution into the original model, 
+        /// such that the values of all variables and constraints are available as usual.
+        /// Since a presolve can be postsolved only once, each LP solve discards the reduced model after its postsolve, 
+        /// and the next LP solve presolves again, warm started from the basis of the original model.
+        /// Until then, tightened bounds of variables and changed objective coefficients of variables that are kept in the reduced model,
+        /// are applied directly to the reduced model. Any other change (e.g., relaxing a bound, changing the bounds of a constraint,
+        /// changing a removed variable, changing a coefficient, adding a constraint, or a MIP solve) discards the reduced model.
+        /// The reductions that depend on the objective are skipped, such that objective changes remain valid.
+        /// Only supported for OsiClp, or OsiCbc with Clp, and not for quadratic objectives. Only used with the Default LPAlgorithm.
+        /// </summary>
+        /// <param name="numberPasses">The maximum number of presolve passes.</param>
+        /// <returns>False if presolve found the LP to be infeasible or unbounded; true otherwise.</returns>
+        public bool Presolve(int numberPasses = 5)
+        {
+            Generate();
+
+            OsiClpSolverInterface osiClp = GetOsiClpSolver();
+            if (osiClp == null) throw new NotSupportedException("Presolve is only supported for OsiClp, or OsiCbc with Clp.");
+            if (objective.IsQuadratic) throw new NotSupportedException("Presolve is not supported for quadratic objectives.");
+
+            DiscardPresolved();
+            usePresolve = true;
+            presolvePasses = numberPasses;
+            return CreatePresolved(osiClp);
+        }
+
+        /// <summary>
+        /// Discards the presolved model, if any, and stops using presolve for subsequent LP solves.
+        /// </summary>
+        public void ClearPresolve()
+        {
+            usePresolve = false;
+            DiscardPresolved();
+        }
+
+        /// <summary>
+        /// Gets whether a presolved model is available for the next LP solve (see Presolve).
+        /// </summary>
+        public bool IsPresolved { get { return presolved != null; } }
+
+        private bool CreatePresolved(OsiClpSolverInterface osiClp)
+        {
+            ClpSimplex original = osiClp.getModelPtr();
+
+            ClpPresolve presolve = new ClpPresolve();
+            // skip the reductions that use the objective, such that changed objective coefficients can be applied to the reduced model
+            presolve.setDoDual(false);
+            presolve.setDoTighten(false);
+            presolve.setDoDupcol(false);
+            presolve.setDoSingletonColumn(false);
+
+            ClpSimplex reduced = presolve.presolvedModel(original, 0.0, false, presolvePasses);
+            if (reduced == null)
+            {
+                log.Info("Presolve found the LP to be infeasible or unbounded.");
+                presolve.Dispose();
+                return false;
+            }
+
+            presolved = new PresolvedModel(presolve, reduced, original.getNumCols(), original.getNumRows());
+            log.InfoFormat("Presolved LP has {0} of {1} rows and {2} of {3} columns.", 
+                reduced.getNumRows(), original.getNumRows(), reduced.getNumCols(), original.getNumCols());
+            return true;
+        }
+
+        /// <summary>
+        /// Solves the presolved model, and postsolves the solution into the original model.
+        /// Returns false if the LP still has to be solved without presolve, e.g., since the reduced model is not optimal.
+        /// </summary>
+        private bool SolvePresolved(OsiClpSolverInterface osiClp)
+        {
+            ClpSimplex original = osiClp.getModelPtr();
+            if (presolved != null && (presolved.numberColumns != original.getNumCols() || presolved.numberRows != original.getNumRows()))
+            {
+                DiscardPresolved();
+            }
+
+            if (presolved == null && !CreatePresolved(osiClp)) return false;
+
+            ClpSimplex reduced = presolved.model;
+            reduced.passInStopFlag(stopFlag);
+            reduced.dual(0);
+            if (!reduced.isProvenOptimal())
+            {
+                log.InfoFormat("Presolved LP finished with status {0}. Solving without presolve.", reduced.status());
+                return false;
+            }
+
+            presolved.presolve.postsolve(true);
+            original.primal(1);
+            log.InfoFormat("Solved presolved LP in {0} iterations, and {1} iterations after postsolve.",
+                reduced.numberIterations(), original.numberIterations());
+
+            // a ClpPresolve can be postsolved only once, so the next LP solve presolves again
+            DiscardPresolved();
+            return true;
+        }
+
+        private void DiscardPresolved()
+        {
+            if (presolved == null) return;
+
+            presolved.Dispose();
+            presolved = null;
+        }
+
+        // Apply the new bounds of the variable at the given offset to the presolved model, before these are set in the solver.
+        // Use NaN for a bound that doesn't change.
+        private void UpdatePresolvedColumnBounds(int offset, double lower, double upper)
+        {
+            if (presolved == null) return;
+
+            unsafe
+            {
+                double* colLower = solver.getColLowerUnsafe();
+                double* colUpper = solver.getColUpperUnsafe();
+                if (double.IsNaN(lower)) lower = colLower[offset];
+                if (double.IsNaN(upper)) upper = colUpper[offset];
+
+                if (!presolved.SetColumnBounds(offset, colLower[offset], colUpper[offset], lower, upper)) DiscardPresolved();
+            }
+        }
+
+        // Apply the new bounds of the constraint at the given offset to the presolved model, before these are set in the solver.
+        // Use NaN for a bound that doesn't change.
+        private void UpdatePresolvedRowBounds(int offset, double lower, double upper)
+        {
+            if (presolved == null) return;
+
+            unsafe
+            {
+                double* rowLower = solver.getRowLowerUnsafe();
+                double* rowUpper = solver.getRowUpperUnsafe();
+                if (double.IsNaN(lower)) lower = rowLower[offset];
+                if (double.IsNaN(upper)) upper = rowUpper[offset];
+
+                if (!presolved.SetRowBounds(offset, rowLower[offset], rowUpper[offset], lower, upper)) DiscardPresolved();
+            }
+        }
+
+        // Apply the new objective coefficient of the variable at the given offset to the presolved model, before it is set in the solver.
+        private void UpdatePresolvedObjective(int offset, double value)
+        {
+            if (presolved == null) return;
+
+            unsafe
+            {
+                double* obj = solver.getObjCoefficientsUnsafe();
+                if (!presolved.SetObjectiveCoefficient(offset, obj[offset], value)) DiscardPresolved();
+            }
+        }
+
+        /// <summary>
+        /// The reduced model and postsolve information of a presolve, with the mapping of the original columns and rows 
+        /// to the columns and rows of the reduced model (-1 if removed).
+        /// The Set methods apply changes of the original model to the reduced model, and return false if that is not possible.
+        /// </summary>
+        private class PresolvedModel : IDisposable
+        {
+            public PresolvedModel(ClpPresolve presolve, ClpSimplex model, int numberColumns, int numberRows)
+            {
+                this.presolve = presolve;
+                this.model = model;
+                this.numberColumns = numberColumns;
+                this.numberRows = numberRows;
+
+                columnMap = Enumerable.Repeat(-1, numberColumns).ToArray();
+                int[] originalColumns = presolve.originalColumns();
+                for (int k = 0; k < originalColumns.Length; k++) columnMap[originalColumns[k]] = k;
+
+                rowMap = Enumerable.Repeat(-1, numberRows).ToArray();
+                int[] originalRows = presolve.originalRows();
+                for (int k = 0; k < originalRows.Length; k++) rowMap[originalRows[k]] = k;
+            }
+
+            public void Dispose()
+            {
+                model.Dispose();
+                presolve.Dispose();
+            }
+
+            public unsafe bool SetColumnBounds(int col, double oldLower, double oldUpper, double lower, double upper)
+            {
+                int k = columnMap[col];
+                if (k < 0) return lower == oldLower && upper == oldUpper;
+                // relaxing is not possible, since presolve may have used the old bound
+                if (lower < oldLower || upper > oldUpper) return false;
+
+                // the reduced bounds can be tighter than the original, e.g., from removed singleton rows
+                double* reducedLower = model.getColLowerUnsafe();
+                double* reducedUpper = model.getColUpperUnsafe();
+                if (lower > reducedLower[k]) model.setColumnLower(k, lower);
+                if (upper < reducedUpper[k]) model.setColumnUpper(k, upper);
+                return true;
+            }
+
+            public bool SetRowBounds(int row, double oldLower, double oldUpper, double lower, double upper)
+            {
+                // the reduced row bounds are not the original bounds shifted by the removed columns, 
+                // since presolve (e.g., duplicate rows) may replace or combine row bounds, so any change discards the presolve
+                return lower == oldLower && upper == oldUpper;
+            }
+
+            public unsafe bool SetObjectiveCoefficient(int col, double oldValue, double value)
+            {
+                int k = columnMap[col];
+                if (k < 0) return value == oldValue;
+
+                // the reduced coefficient may include the costs of substituted columns, so change by the difference
+                double* obj = model.getObjCoefficientsUnsafe();
+                model.setObjectiveCoefficient(k, obj[k] + (value - oldValue));
+                return true;
+            }
+
+            public ClpPresolve presolve;
+            public ClpSimplex model;
+            public int numberColumns;
+            public int numberRows;
+            private int[] columnMap;
+            private int[] rowMap;
+        }
+        #endregion
+
+        #region Solve Scenarios
+        /// <summary>
+        /// Solves the given scenarios in parallel, and returns the results per scenario.
+        /// The model is generated only once. Then, each worker thread gets its own clone of the OsiSolver
+        /// on which it solves its share of the scenarios: apply the modifications of the scenario, solve, and undo the modifications.
+        /// The model and this solver (incl. the solution values of the variables etc.) are not changed.
+        /// For MIP, each scenario is solved on a fresh copy of the worker's clone, using branch and bound. The CbcSolverArgs are not used.
+        /// Note, no solver messages are logged for the scenarios.
+        /// </summary>
+        /// <param name="scenarios">The scenarios to solve.</param>
+        /// <param name="storeSolutions">Store the variable values of the solution of each scenario.</param>
+        /// <param name="forceRelaxation">Force solving of the LP relaxation.</param>
+        /// <param name="maxDegreeOfParallelism">The maximum number of worker threads, or -1 for the number of processors.</param>
+        /// <returns>The results of the scenarios, in the order of the given scenarios.</returns>
+        public ScenarioResults SolveScenarios(IList<Scenario> scenarios, bool storeSolutions = false, bool forceRelaxation = false, int maxDegreeOfParallelism = -1)
+        {
+            Ensure.NotNull(scenarios, "scenarios");
+
+            double genStart = CoinUtils.CoinCpuTime();
+
+            // Note: always call Generate! But only once for all scenarios.
+            Generate();
+
+            bool isMip = forceRelaxation == false && IsMIP;
+            int numberOfScenarios = scenarios.Count;
+            int numberOfVariables = variables.Count;
+            double objectiveConstant = objective.Constant;
+            ScenarioResults results = new ScenarioResults(this, numberOfScenarios, numberOfVariables, storeSolutions);
+
+            // The offsets are determined here, since the workers should not touch the model or the Sonnet entities.
+            ScenarioChanges[] changes = new ScenarioChanges[numberOfScenarios];
+            for (int s = 0; s < numberOfScenarios; s++)
+            {
+                Ensure.NotNull(scenarios[s], "scenario");
+                changes[s] = new ScenarioChanges(this, scenarios[s]);
+            }
+
+            // The original values, to undo the changes of each scenario. Read-only for the workers.
+            double[] colLower = solver.getColLower();
+            double[] colUpper = solver.getColUpper();
+            double[] rowLower = solver.getRowLower();
+            double[] rowUpper = solver.getRowUpper();
+            double[] objCoefs = solver.getObjCoefficients();
+            double objSense = solver.getObjSense();
+
+            int numberOfWorkers = (maxDegreeOfParallelism > 0) ? maxDegreeOfParallelism : Environment.ProcessorCount;
+            numberOfWorkers = Math.Max(1, Math.Min(numberOfWorkers, numberOfScenarios));
+
+            log.InfoFormat("Solving {0} scenarios using {1} workers", numberOfScenarios, numberOfWorkers);
+
+            List<ScenarioWorker> allWorkers = new List<ScenarioWorker>();
+            ConcurrentBag<ScenarioWorker> idleWorkers = new ConcurrentBag<ScenarioWorker>();
+            for (int w = 0; w < numberOfWorkers; w++)
+            {
+                ScenarioWorker worker = new ScenarioWorker(solver);
+                allWorkers.Add(worker);
+                idleWorkers.Add(worker);
+            }
+
+            try
+            {
+                ParallelOptions options = new ParallelOptions();
+                options.MaxDegreeOfParallelism = numberOfWorkers;
+
+                Parallel.For(0, numberOfScenarios, options,
+                    () =>
+                    {
+                        ScenarioWorker worker;
+                        if (idleWorkers.TryTake(out worker)) return worker;
+
+                        // should not happen, but just in case Parallel.For has more tasks running than MaxDegreeOfParallelism
+                        lock (allWorkers)
+                        {
+                            worker = new ScenarioWorker(solver);
+                            allWorkers.Add(worker);
+                            return worker;
+                        }
+                    },
+                    (s, loopState, worker) =>
+                    {
+                        ScenarioChanges change = changes[s];
+                        OsiSolverInterface scenarioSolver = isMip ? worker.solver.clone() : worker.solver;
+                        try
+                        {
+                            change.Apply(scenarioSolver);
+
+                            if (isMip)
+                            {
+                                if (scenarioSolver is OsiCbcSolverInterface)
+                                {
+                                    CbcModel scenarioModel = ((OsiCbcSolverInterface)scenarioSolver).getModelPtr();
+                                    ApplyMIPLimits(scenarioModel, objSense);
+                                    scenarioModel.branchAndBound();
+                                }
+                                else scenarioSolver.branchAndBound();
+                            }
+                            else
+                            {
+                                if (worker.solved) scenarioSolver.resolve();
+                                else scenarioSolver.initialSolve();
+                                worker.solved = true;
+                            }
+
+                            results.isProvenOptimal[s] = scenarioSolver.isProvenOptimal();
+                            results.isProvenPrimalInfeasible[s] = scenarioSolver.isProvenPrimalInfeasible();
+                            results.isProvenDualInfeasible[s] = scenarioSolver.isProvenDualInfeasible();
+                            results.objectiveValues[s] = scenarioSolver.getObjValue() + objectiveConstant;
+                            if (storeSolutions)
+                            {
+                                unsafe
+                                {
+                                    double* values = scenarioSolver.getColSolutionUnsafe();
+                                    Marshal.Copy(new IntPtr(values), results.solutions, s * numberOfVariables, numberOfVariables);
+                                }
+                            }
+
+                            if (!isMip) change.Undo(scenarioSolver, colLower, colUpper, rowLower, rowUpper, objCoefs);
+                        }
+                        finally
+                        {
+                            if (isMip) scenarioSolver.Dispose();
+                        }
+
+                        return worker;
+                    },
+                    (worker) => idleWorkers.Add(worker));
+            }
+            finally
+            {
+                foreach (ScenarioWorker worker in allWorkers) worker.Dispose();
+            }
+
+            log.InfoFormat("Done solving scenarios after {0}", (CoinUtils.CoinCpuTime() - genStart));
+            return results;
         }
 
         /// <summary>
-        /// Get the used OsiSolver
+        /// The modifications of a scenario, in terms of the offsets within this solver.
         /// </summary>
-        public OsiSolverInterface OsiSolver
+        private class ScenarioChanges
         {
-            get { return this.solver; }
+            public ScenarioChanges(Solver solver, Scenario scenario)
+            {
+                int n = scenario.variableBounds.Count;
+                cols = new int[n];
+                colLower = new double[n];
+                colUpper = new double[n];
+                for (int i = 0; i < n; i++)
+                {
+                    cols[i] = solver.Offset(scenario.variableBounds[i].Item1);
+                    colLower[i] = scenario.variableBounds[i].Item2;
+                    colUpper[i] = scenario.variableBounds[i].Item3;
+                }
+
+                int m = scenario.constraintBounds.Count;
+                rows = new int[m];
+                rowLower = new double[m];
+                rowUpper = new double[m];
+                for (int i = 0; i < m; i++)
+                {
+                    rows[i] = solver.Offset(scenario.constraintBounds[i].Item1);
+                    rowLower[i] = scenario.constraintBounds[i].Item2;
+                    rowUpper[i] = scenario.constraintBounds[i].Item3;
+                }
+
+                int k = scenario.objectiveCoefficients.Count;
+                objCols = new int[k];
+                objCoefs = new double[k];
+                for (int i = 0; i < k; i++)
+                {
+                    objCols[i] = solver.Offset(scenario.objectiveCoefficients[i].Item1);
+                    objCoefs[i] = scenario.objectiveCoefficients[i].Item2;
+                }
+            }
+
+            public void Apply(OsiSolverInterface solver)
+            {
+                for (int i = 0; i < cols.Length; i++) solver.setColBounds(cols[i], colLower[i], colUpper[i]);
+                for (int i = 0; i < rows.Length; i++) solver.setRowBounds(rows[i], rowLower[i], rowUpper[i]);
+                for (int i = 0; i < objCols.Length; i++) solver.setObjCoeff(objCols[i], objCoefs[i]);
+            }
+
+            public void Undo(OsiSolverInterface solver, double[] originalColLower, double[] originalColUpper,
+                double[] originalRowLower, double[] originalRowUpper, double[] originalObjCoefs)
+            {
+                for (int i = 0; i < cols.Length; i++) solver.setColBounds(cols[i], originalColLower[cols[i]], originalColUpper[cols[i]]);
+                for (int i = 0; i < rows.Length; i++) solver.setRowBounds(rows[i], originalRowLower[rows[i]], originalRowUpper[rows[i]]);
+                for (int i = 0; i < objCols.Length; i++) solver.setObjCoeff(objCols[i], originalObjCoefs[objCols[i]]);
+            }
+
+            private int[] cols;
+            private double[] colLower;
+            private double[] colUpper;
+            private int[] rows;
+            private double[] rowLower;
+            private double[] rowUpper;
+            private int[] objCols;
+            private double[] objCoefs;
         }
 
         /// <summary>
-        /// Get the full name of the type of OsiSolver.
-        /// For example, "COIN.OsiClpSolverInterface"
+        /// A clone of the OsiSolver with its own (silent) message handler, used by one thread at a time.
         /// </summary>
-        public string OsiSolverFullName
+        private class ScenarioWorker : IDisposable
         {
-            get { return this.solver.GetType().FullName; }
+            public ScenarioWorker(OsiSolverInterface original)
+            {
+                solver = original.clone();
+                handler = new CoinMessageHandler();
+                handler.setLogLevel(0);
+                solver.passInMessageHandler(handler);
+            }
+
+            public void Dispose()
+            {
+                solver.Dispose();
+                handler.Dispose();
+            }
+
+            public OsiSolverInterface solver;
+            public CoinMessageHandler handler;
+            public bool solved;
         }
+        #endregion
 
-        #region Get Model propeties
+        #region Sensitivity methods
         /// <summary>
-        /// Get whether this model was already generated (at least) once before.
-        /// Note, if alterations have been made after the last solve (Generate), then still this will return true.
+        /// Parametric analysis of the LP (relaxation) along the given direction, in one native call (Clp parametrics).
+        /// For theta from startingTheta to endingTheta, the bounds, rhs and objective coefficients are their current value + theta * change.
+        /// Returns the breakpoints and the objective values, i.e., the piecewise-linear value function.
+        /// Afterwards, the solver is resolved for the current model (theta = 0).
+        /// Only supported for OsiClp, or OsiCbc with Clp, and not for quadratic objectives.
         /// </summary>
-        protected bool Generated
+        /// <param name="direction">The changes per unit of theta.</param>
+        /// <param name="startingTheta">The starting theta.</param>
+        /// <param name="endingTheta">The requested ending theta.</param>
+        /// <param name="reportIncrement">If 0.0 (default), report all breakpoints; otherwise report at startingTheta + k * reportIncrement.</param>
+        /// <returns>The result of the parametric analysis.</returns>
+        public ParametricsResult Parametrics(ParametricDirection direction, double startingTheta, double endingTheta, double reportIncrement = 0.0)
         {
-            get { return generated; }
-        }
+            Ensure.NotNull(direction, "direction");
 
-        #endregion
+            Generate();
 
-        internal void ApplyObjective(Objective objective)
-        {
-            Ensure.NotNull(objective, "objective");
-            Ensure.NotNull(this.objective, "this.objective");
-            // this method should ONLY be called FROM the model
+            OsiClpSolverInterface osiClp = GetOsiClpSolver();
+            if (osiClp == null) throw new NotSupportedException("Parametrics is only supported for OsiClp, or OsiCbc with Clp.");
+            if (objective.IsQuadratic) throw new NotSupportedException("Parametrics is not supported for quadratic objectives.");
 
-            if (Generated)
+            int n = variables.Count;
+            int m = constraints.Count;
+
+            double[] changeLowerBound = null;
+            double[] changeUpperBound = null;
+            if (direction.variableBoundChanges.Count > 0)
             {
-                this.objective.Unregister(this);
-                this.objective = objective;
-                Generate(this.objective);
+                changeLowerBound = new double[n];
+                changeUpperBound = new double[n];
+                foreach (Tuple<Variable, double, double> change in direction.variableBoundChanges)
+                {
+                    int col = Offset(change.Item1);
+                    changeLowerBound[col] = change.Item2;
+                    changeUpperBound[col] = change.Item3;
+                }
             }
-            else
+
+            double[] changeLowerRhs = null;
+            double[] changeUpperRhs = null;
+            if (direction.constraintBoundChanges.Count > 0)
             {
-                this.objective = objective;
+                changeLowerRhs = new double[m];
+                changeUpperRhs = new double[m];
+                foreach (Tuple<Constraint, double, double> change in direction.constraintBoundChanges)
+                {
+                    int row = Offset(change.Item1);
+                    changeLowerRhs[row] = change.Item2;
+                    changeUpperRhs[row] = change.Item3;
+                }
             }
-        }
 
-        internal void ApplyObjectiveSense(ObjectiveSense sense)
-        {
-            // (1 for min (default), -1 for max)
-            switch (sense)
+            double[] changeObjective = null;
+            if (direction.objectiveChanges.Count > 0)
             {
-                case ObjectiveSense.Maximise:
-                    solver.setObjSense(-1.0);
-                    break;
-                case ObjectiveSense.Minimise:
-                    solver.setObjSense(1.0);
-                    break;
-                default:
-                    throw new ArgumentOutOfRangeException("Unknown objective function sense : " + sense);
+                changeObjective = new double[n];
+                foreach (Tuple<Variable, double> change in direction.objectiveChanges)
+                {
+                    changeObjective[Offset(change.Item1)] = change.Item2;
+                }
             }
-        }
-
-        /// <summary>
-        /// Adds (a reference) the given constraint to the model
-        /// </summary>
-        /// <param name="con">The constraint to add to the model.</param>
-        internal void Add(Constraint con)
-        {
-            Ensure.NotNull(con, "con");
 
-            rawconstraints.Add(con);
-        }
+            double[] thetas;
+            double[] objectiveValues;
+            int status;
+            try
+            {
+                isSolving = true;
+                status = osiClp.getModelPtr().parametrics(startingTheta, ref endingTheta, reportIncrement,
+                    changeLowerBound, changeUpperBound, changeLowerRhs, changeUpperRhs, changeObjective,
+                    out thetas, out objectiveValues);
 
-        #region Solve, Resolve, Maximise and Minimise Methods
-        ///<summary>
-        /// Maximises the model.
-        /// This implicitly sets the objective sense to Maximise.
-        /// The method uses branch and bound if model is MIP and LP otherwise.
-        /// </summary>
-        /// <param name="forceRelaxation">Force solving of the LP relaxation</param>
-        public void Maximise(bool forceRelaxation = false)
-        {
-            ApplyObjectiveSense(ObjectiveSense.Maximise);
-            if (!Generated) Solve(forceRelaxation);
-            else Resolve(forceRelaxation);
-        }
+                // back to the current model
+                solver.resolve();
+                AssignSolution(false);
+            }
+            catch (Exception e)
+            {
+                log.Error(e.ToString());
+                throw;
+            }
+            finally
+            {
+                isSolving = false;
+            }
 
-        ///<summary>
-        /// Minimises the model.
-        /// This implicitly sets the objective sense to Minimise.
-        /// The method uses branch and bound if model is MIP and LP otherwise.
-        /// </summary>
-        /// <param name="forceRelaxation">Force solving of the LP relaxation.</param>
-        public void Minimise(bool forceRelaxation = false)
-        {
-            ApplyObjectiveSense(ObjectiveSense.Minimise);
-            if (!Generated) Solve(forceRelaxation);
-            else Resolve(forceRelaxation);
-        }
+            double constant = objective.Constant;
+            for (int i = 0; i < objectiveValues.Length; i++) objectiveValues[i] += constant;
 
-        /// <summary>
-        /// Solve the model according to the ObjectiveSense settings.
-        /// The method uses branch and bound if model is MIP and LP otherwise.
-        /// </summary>
-        /// <param name="forceRelaxation">Force solving of the LP relaxation.</param>
-        public void Solve(bool forceRelaxation = false)
-        {
-            Solve(false, forceRelaxation);
+            log.InfoFormat("Parametrics found {0} breakpoints up to theta {1} with status {2}", thetas.Length, endingTheta, status);
+            return new ParametricsResult(thetas, objectiveValues, endingTheta, status);
         }
 
         /// <summary>
-        /// Resolve the model according to the ObjectiveSense settings.
-        /// The method uses branch and bound if model is MIP and LP otherwise.
+        /// Sensitivity ranging of the optimal LP solution: the cost ranges of the given variables (Clp dual ranging) and 
+        /// the rhs ranges of the given constraints (Clp primal ranging), in one pass over the final basis each. 
+        /// For non-binding constraints, the rhs range follows from the row activity instead of primal ranging.
+        /// The last solve must have been an LP (or relaxation) solve that is proven optimal.
+        /// Only supported for OsiClp, or OsiCbc with Clp, and not for quadratic objectives.
         /// </summary>
-        /// <param name="forceRelaxation">Force solving of the LP relaxation.</param>
-        public void Resolve(bool forceRelaxation = false)
-        {
-            Solve(true, forceRelaxation);
-        }
-
-        private void Solve(bool doResolve, bool forceRelaxation)
-        {
-            if (doResolve)
-            {
-                if (!Generated) throw new SonnetException("Cannot Resolve a model that hasn't been generated yet.");
+        /// <param name="variables">The variables to get the cost ranges for. Can be null.</param>
+        /// <param name="constraints">The constraints to get the rhs ranges for. Can be null.</param>
+        /// <returns>The ranges, in the order of the given variables and constraints.</returns>
+        public RangingResult Ranging(IList<Variable> variables, IList<Constraint> constraints)
+        {
+            OsiClpSolverInterface osiClp = GetOsiClpSolver();
+            if (osiClp == null) throw new NotSupportedException("Ranging is only supported for OsiClp, or OsiCbc with Clp.");
+            if (objective.IsQuadratic) throw new NotSupportedException("Ranging is not supported for quadratic objectives.");
+            if (!IsProvenOptimal) throw new SonnetException("Ranging requires an optimal solution of the LP.");
+
+            int n = this.variables.Count;
+            int nvar = (variables != null) ? variables.Count : 0;
+            int ncon = (constraints != null) ? constraints.Count : 0;
+
+            int[] whichColumns = new int[nvar];
+            for (int i = 0; i < nvar; i++) whichColumns[i] = Offset(variables[i]);
+
+            double[] costIncrease = new double[nvar];
+            double[] costDecrease = new double[nvar];
+            double[] rhsIncrease = new double[ncon];
+            double[] rhsDecrease = new double[ncon];
+
+            ClpSimplex clpSimplex = osiClp.getModelPtr();
+            if (nvar > 0)
+            {
+                int[] sequenceIncrease = new int[nvar];
+                int[] sequenceDecrease = new int[nvar];
+                clpSimplex.dualRanging(whichColumns, costIncrease, sequenceIncrease, costDecrease, sequenceDecrease);
             }
 
-            double genStart = CoinUtils.CoinCpuTime();
-
-            // Note: always call Generate!
-            Generate();
-
-            try
+            if (ncon > 0)
             {
-                if (forceRelaxation == false && IsMIP)
+                // primalRanging is only valid for non-basic slacks. A basic slack means a non-binding constraint,
+                // whose rhs can move freely away from the row activity, and up to the row activity towards it.
+                double[] rowActivity = osiClp.getRowActivity();
+                double[] rowLower = osiClp.getRowLower();
+                double[] rowUpper = osiClp.getRowUpper();
+
+                List<int> nonBasic = new List<int>();
+                for (int i = 0; i < ncon; i++)
                 {
-                    if (objective.IsQuadratic)
+                    int row = Offset(constraints[i]);
+                    if (!clpSimplex.isRowBasic(row))
                     {
-                        log.Warn("Only experimantal support for MIQP!");
+                        nonBasic.Add(i);
+                        continue;
                     }
 
-                    isSolving = true;
-                    if (AutoResetMIPSolve) SaveBeforeMIPSolveInternal();
-
-                    if (solver is OsiCbcSolverInterface)
+                    // For a range with both sides finite, the upper side is reported.
+                    if (rowUpper[row] < 1.0e30)
                     {
-                        OsiCbcSolverInterface cbcSolver = (OsiCbcSolverInterface)solver;
-                        #warning "SONNET: Clean this code. Experimental only."
-                        if (!objective.IsQuadratic && cbcSolver.UseBranchAndBound())
-                        {
-                            cbcSolver.getModelPtr().branchAndBound();
-                            //cbcSolver.branchAndBound(); // this somehow DOESNT work (wrong obj value) if Quadratic
-                        }
-                        else
-                        {
-                            string[] cbcMainArgs = cbcSolver.GetCbcSolverArgs();
-                            List<string> args = new List<string>();
-                            args.Add("Sonnet");
-                            if (cbcSolver.UseBranchAndBound())
-                            {
-                                args.Add("-solve");
-                                //args.Add("-solution");
-                                //args.Add("out.txt");
-                            }
-                            else
-                            { 
-                                args.AddRange(cbcMainArgs);
-                                args.Add("-solve");
-                            }
-                            args.Add("-quit");
-
-                            CbcSolver.CbcMain0(cbcSolver.getModelPtr());
-                            CbcSolver.CbcMain1(args.ToArray(), cbcSolver.getModelPtr());
-                        }
+                        rhsIncrease[i] = MathUtils.Infinity;
+                        rhsDecrease[i] = rowUpper[row] - rowActivity[row];
+                    }
+                    else if (rowLower[row] > -1.0e30)
+                    {
+                        rhsIncrease[i] = rowActivity[row] - rowLower[row];
+                        rhsDecrease[i] = MathUtils.Infinity;
                     }
                     else
                     {
-                        solver.branchAndBound();
+                        rhsIncrease[i] = MathUtils.Infinity;
+                        rhsDecrease[i] = MathUtils.Infinity;
                     }
-
-
-                    AssignSolution(true);
-                    if (AutoResetMIPSolve) ResetAfterMIPSolveInternal(); // mainly to reset bounds etc, but use AssignSolutionStatus because the Reset messes up the IsProvenOptimal etc!
                 }
-                else
+
+                if (nonBasic.Count > 0)
                 {
-                    isSolving = true;
-                    if (doResolve) solver.resolve();
-                    else solver.initialSolve();
-                    AssignSolution(false);
+                    int m = nonBasic.Count;
+                    int[] whichRows = new int[m];
+                    for (int k = 0; k < m; k++) whichRows[k] = n + Offset(constraints[nonBasic[k]]); // rows are numbered after the columns
+
+                    double[] increase = new double[m];
+                    double[] decrease = new double[m];
+                    int[] sequenceIncrease = new int[m];
+                    int[] sequenceDecrease = new int[m];
+                    clpSimplex.primalRanging(whichRows, increase, sequenceIncrease, decrease, sequenceDecrease);
+
+                    for (int k = 0; k < m; k++)
+                    {
+                        rhsIncrease[nonBasic[k]] = increase[k];
+                        rhsDecrease[nonBasic[k]] = decrease[k];
+                    }
                 }
             }
-            catch (Exception e)
-            {
-                log.Error(e.ToString());
-                throw;
-            }
-            finally
-            {
-                isSolving = false;
-            }
 
-            log.InfoFormat(" IsAbandoned: {0}", IsAbandoned);
-            log.InfoFormat(" IsProvenOptimal: {0}", IsProvenOptimal);
-            log.InfoFormat(" IsProvenDualInfeasible: {0}", IsProvenDualInfeasible);
-            log.InfoFormat(" IsProvenPrimalInfeasible: {0}", IsProvenPrimalInfeasible);
-            log.InfoFormat(" IsPrimalObjectiveLimitReached: {0}", IsPrimalObjectiveLimitReached);
-            log.InfoFormat(" IsDualObjectiveLimitReached: {0}", IsDualObjectiveLimitReached);
+            NormalizeRanges(costIncrease);
+            NormalizeRanges(costDecrease);
+            NormalizeRanges(rhsIncrease);
+            NormalizeRanges(rhsDecrease);
 
-            log.InfoFormat("Done resolving after {0}", (CoinUtils.CoinCpuTime() - genStart));
+            return new RangingResult(costIncrease, costDecrease, rhsIncrease, rhsDecrease);
         }
 
+        /// <summary>
+        /// Make the ranges non-negative amounts, and use MathUtils.Infinity for the large values that Clp uses for unlimited.
+        /// </summary>
+        /// <param name="ranges">The ranges to normalize.</param>
+        private static void NormalizeRanges(double[] ranges)
+        {
+            for (int i = 0; i < ranges.Length; i++)
+            {
+                double range = Math.Abs(ranges[i]);
+                ranges[i] = (range >= 1.0e30) ? MathUtils.Infinity : range;
+            }
+        }
         #endregion
 
         /// <summary>
@@ -513,6 +2187,8 @@ namespace Sonnet
         
         private void ResetAfterMIPSolveInternal()
         {
+            DiscardPresolved();
+
             //TODO: this needs some work: ResetAfterMIPSolve also clears the solution, so afterwards any AssignSolution yields all zero values!
             // so, either we always AssignSolution, and discourage the user from calling it (in MIP),
             // or we (force) manual ResetAfterMIPSolve from the user in MIP.
@@ -523,18 +2199,18 @@ namespace Sonnet
             // But the problem with ResetAfterMIPSolve is bigger: also the solver.get.. functions (getObjValue etc) no longer work
             if (solver is OsiCbcSolverInterface)
             {
-                // Since the model was already generated before, we can safely Reset to the reference solver instance 
-                // see also at the end of Generate()
+                // Restore the bounds etc. in place from the state saved before the MIP solve.
+                // This keeps the solver (incl. its solution and hints), instead of constructing a new one from a reference solver.
                 OsiCbcSolverInterface osiCbcModel = ((OsiCbcSolverInterface)solver);
-                osiCbcModel.resetModelToReferenceSolver();
+                if (!osiCbcModel.resetModelToReferenceState())
+                {
+                    throw new SonnetException("Cannot reset the MIP solver to its state before the MIP solve.");
+                }
             }
             else
             {
-                solver.restoreBaseModel(solver.getNumRows());
-                // Restore bounds and dual limit
-                solver.setColLower(saveColLower);
-                solver.setColUpper(saveColUpper);
-                solver.setDblParam(OsiDblParam.OsiDualObjectiveLimit, saveOsiDualObjectiveLimit);
+                // Delete the rows added, and restore the bounds that changed and the dual limit, from the native snapshot
+                solver.restoreBounds();
             }
         }
 
@@ -558,15 +2234,12 @@ namespace Sonnet
         {
             if (solver is OsiCbcSolverInterface)
             {
-                // save the new reference solver including the new constraints.
-                ((OsiCbcSolverInterface)solver).saveModelReferenceSolver();
+                // save the bounds etc. of the solver including the new constraints, without cloning the solver.
+                ((OsiCbcSolverInterface)solver).saveModelReferenceState();
             }
             else
             {
-                saveColLower = solver.getColLower(); // a copy!
-                saveColUpper = solver.getColUpper(); // a copy!
-                solver.getDblParam(OsiDblParam.OsiDualObjectiveLimit, out saveOsiDualObjectiveLimit);
-                solver.saveBaseModel();
+                solver.saveBounds();
             }
         }
         #endregion
@@ -1232,6 +2905,8 @@ namespace Sonnet
             if (Generated)
             {
                 generated = false;
+                DiscardPresolved();
+                if (cbcSolverSession != null) cbcSolverSession.reset();
 
                 if (object.ReferenceEquals(null, objective)) throw new NullReferenceException("Ungenerate: A generated model must have a valid objective function");
                 objective.Unregister(this);
@@ -1459,7 +3134,7 @@ namespace Sonnet
         /// </summary>
         /// <param name="con">The constraint.</param>
         /// <returns>The integer offset of the given constraint in the current solver.</returns>
-        private int Offset(Constraint con)
+        internal int Offset(Constraint con)
         {
             Ensure.NotNull(con, "constraint");
             if (!con.IsRegistered(this)) throw new SonnetException("Constraint not registered with model.");
@@ -1477,7 +3152,7 @@ namespace Sonnet
         /// </summary>
         /// <param name="var">The variable.</param>
         /// <returns>The integer offset of the given variable in the current solver.</returns>
-        private int Offset(Variable var)
+        internal int Offset(Variable var)
         {
             Ensure.NotNull(var, "variable");
 
@@ -1790,6 +3465,69 @@ namespace Sonnet
         /// Is the solver busy Solving?
         /// </summary>
         public bool IsSolving { get { return this.isSolving; } }
+
+        /// <summary>
+        /// Requests the current solve to stop as soon as possible. Can be called from any thread.
+        /// Clp stops at the end of its next iteration, and Cbc at its next node, with the best solution found so far.
+        /// The solve then returns as usual, and IsCancelled is true. Has no effect on later solves.
+        /// Only supported for OsiClp and OsiCbc; scenario solves are not cancelled.
+        /// </summary>
+        public void Cancel()
+        {
+            stopFlag.stop();
+
+            CbcModel cbcModel = solvingCbcModel;
+            if (cbcModel != null) cbcModel.sayEventHappened();
+        }
+
+        /// <summary>
+        /// Was the latest solve cancelled, via Cancel(), the CancellationToken or the TimeLimit?
+        /// </summary>
+        public bool IsCancelled { get { return this.isCancelled; } }
+
+        /// <summary>
+        /// Gets or sets the cancellation token for solves (None). If the token is cancelled during a solve, Cancel() is called.
+        /// </summary>
+        public System.Threading.CancellationToken CancellationToken
+        {
+            get { return this.cancellationToken; }
+            set { this.cancellationToken = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets whether to collect the telemetry of each solve (false). See Telemetry.
+        /// </summary>
+        public bool CollectTelemetry
+        {
+            get { return this.collectTelemetry; }
+            set { this.collectTelemetry = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the number of nodes per point of the time series of the telemetry of MIP solves (100).
+        /// Each new incumbent is also a point of the time series.
+        /// </summary>
+        public int TelemetryNodeInterval
+        {
+            get { return this.telemetryNodeInterval; }
+            set { this.telemetryNodeInterval = value; }
+        }
+
+        /// <summary>
+        /// Gets the telemetry of the latest (or current) solve, or null if CollectTelemetry was false.
+        /// During a solve, the time series can be read from another thread.
+        /// </summary>
+        public SolveTelemetry Telemetry { get { return this.telemetry; } }
+
+        /// <summary>
+        /// Gets or sets the maximum (wall clock) duration of each solve (null: no limit). Once passed, Cancel() is called.
+        /// For MIP, this is also a maximum number of seconds for Cbc, as MIPMaximumSeconds.
+        /// </summary>
+        public TimeSpan? TimeLimit
+        {
+            get { return this.timeLimit; }
+            set { this.timeLimit = value; }
+        }
         /// <summary>
         /// Are there numerical difficulties?
         /// </summary>
@@ -1831,6 +3569,7 @@ namespace Sonnet
             Ensure.NotNull(var, "variable");
 
             int offset = Offset(var);
+            UpdatePresolvedColumnBounds(offset, double.NaN, upper);
             solver.setColUpper(offset, upper);
         }
 
@@ -1839,6 +3578,7 @@ namespace Sonnet
             Ensure.NotNull(var, "variable");
 
             int offset = Offset(var);
+            UpdatePresolvedColumnBounds(offset, lower, double.NaN);
             solver.setColLower(offset, lower);
         }
         
@@ -1847,6 +3587,7 @@ namespace Sonnet
             Ensure.NotNull(var, "variable");
 
             int offset = Offset(var);
+            UpdatePresolvedColumnBounds(offset, lower, upper);
             solver.setColBounds(offset, lower, upper);
         }
 
@@ -1883,6 +3624,7 @@ namespace Sonnet
             Ensure.NotNull(var, "variable");
 
             int offset = Offset(var);
+            UpdatePresolvedObjective(offset, value);
             solver.setObjCoeff(offset, value);
         }
         
@@ -1905,6 +3647,7 @@ namespace Sonnet
 
             int conOffset = Offset(con);
             int varOffset = Offset(var);
+            DiscardPresolved();
 
             if (solver is OsiClpSolverInterface)
             {
@@ -1939,6 +3682,7 @@ namespace Sonnet
 
             int offset = Offset(con);
             //if (SolverType == SolverType.CpxSolver) solver.setRowBounds(offset, con.Lower, upper);
+            UpdatePresolvedRowBounds(offset, double.NaN, upper);
             solver.setRowUpper(offset, upper);
         }
         internal void SetConstraintLower(RangeConstraint con, double lower)
@@ -1947,6 +3691,7 @@ namespace Sonnet
 
             int offset = Offset(con);
             //if (SolverType == SolverType.CpxSolver) solver.setRowBounds(offset, lower, con.Upper);
+            UpdatePresolvedRowBounds(offset, lower, double.NaN);
             solver.setRowLower(offset, lower);
         }
         internal void SetConstraintBounds(RangeConstraint con, double lower, double upper)
@@ -1954,6 +3699,7 @@ namespace Sonnet
             Ensure.NotNull(con, "range constraint");
 
             int offset = Offset(con);
+            UpdatePresolvedRowBounds(offset, lower, upper);
             solver.setRowBounds(offset, lower, upper);
         }
         internal void SetConstraintEnabled(Constraint con, bool enable)
@@ -1961,6 +3707,7 @@ namespace Sonnet
             Ensure.NotNull(con, "range constraint");
 
             int offset = Offset(con);
+            DiscardPresolved();
             if (!enable)
             {
                 double range = con.Upper - con.Lower;
@@ -2032,9 +3779,40 @@ namespace Sonnet
 
         private bool generated;
         private bool autoResetMIPSolve = true;
-        private double saveOsiDualObjectiveLimit;
-        private double[] saveColLower;
-        private double[] saveColUpper;
+        private LPAlgorithm lpAlgorithm = LPAlgorithm.Default;
+        private ClpCholeskyType barrierCholesky = ClpCholeskyType.Native;
+        private bool barrierCrossover = true;
+        private ClpSolve clpSolveOptions = null;
+        private MIPPreProcess mipPreProcess = MIPPreProcess.None;
+        private int mipPreProcessPasses = 5;
+        private double? mipMaximumSeconds = null;
+        private int? mipMaximumNodes = null;
+        private int? mipMaximumSolutions = null;
+        private double? mipAllowableGap = null;
+        private double? mipAllowableFractionGap = null;
+        private double? mipCutoff = null;
+        private double[] mipStart = null;
+        private CbcSolverSession cbcSolverSession = null;
+        private bool hasBranchingObjects = false;
+        private MIPNodeSelection mipNodeSelection = MIPNodeSelection.Default;
+        private int hybridMaximumDiveDepth = int.MaxValue;
+        private int hybridDiveNodeLimit = 0;
+        private bool hasNodeComparison = false;
+        private PseudoCosts pseudoCosts = null;
+        private PseudoCosts pseudoCostsStart = null;
+        private CbcCutPool cutPool = null;
+        private CbcCutPool cutPoolStart = null;
+        private bool cutPoolPurgeNotTight = false;
+        private double cutPoolTolerance = 1e-6;
+        private List<CutGeneratorEntry> cutGenerators = new List<CutGeneratorEntry>();
+        private double mipStartTolerance = 1e-6;
+        private bool mipCutoffFromSolution = false;
+        private bool mipObjectiveGranularity = false;
+        private bool mipReducedCostFixing = false;
+        private bool isMIPStartAccepted = false;
+        private bool usePresolve = false;
+        private int presolvePasses = 5;
+        private PresolvedModel presolved = null;
 
         // solution status
         private bool isAbandoned;
@@ -2047,6 +3825,16 @@ namespace Sonnet
         private int iterationCount;
 
         private bool isSolving = false; // used for interrupting a solve
+        private bool isCancelled = false;
+        private CoinStopFlag stopFlag = new CoinStopFlag(); // not disposed explicitly, since timers and tokens may still call Cancel
+        private volatile CbcModel solvingCbcModel = null;
+        private System.Threading.CancellationToken cancellationToken = System.Threading.CancellationToken.None;
+        private System.Threading.CancellationTokenRegistration cancellationRegistration;
+        private System.Threading.Timer cancelTimer = null;
+        private TimeSpan? timeLimit = null;
+        private bool collectTelemetry = false;
+        private int telemetryNodeInterval = 100;
+        private SolveTelemetry telemetry = null;
 
         private OsiSolverInterface solver;
         private Model model;
@@ -0,0 +1,232 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Text;
+
+using COIN;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// The class SolveTelemetry contains the progress of one solve: the time per phase and the number of iterations,
+    /// and for MIP solved by Cbc, the root timings and a time series of the incumbent, the best possible objective value, 
+    /// the gap, the open nodes and the LP iterations. The time series are collected natively by a Cbc event handler, 
+    /// at every solver.TelemetryNodeInterval nodes and at each new incumbent.
+    /// During a solve, the time series are read from the records collected so far. 
+    /// All times are in CPU seconds. Use via solver.CollectTelemetry and solver.Telemetry.
+    /// </summary>
+    public class SolveTelemetry
+    {
+        internal SolveTelemetry(bool isMIP, double objectiveConstant)
+        {
+            this.isMIP = isMIP;
+            this.objectiveConstant = objectiveConstant;
+            this.rootLPSeconds = double.NaN;
+            this.rootSeconds = double.NaN;
+        }
+
+        /// <summary>
+        /// Gets whether the solve was a MIP solve.
+        /// </summary>
+        public bool IsMIP { get { return isMIP; } }
+
+        /// <summary>
+        /// Gets the seconds spent generating the model in the solver.
+        /// </summary>
+        public double GenerateSeconds { get { return generateSeconds; } }
+
+        /// <summary>
+        /// Gets the seconds spent solving, that is, in the LP algorithm or the branch and bound.
+        /// </summary>
+        public double SolveSeconds { get { return solveSeconds; } }
+
+        /// <summary>
+        /// Gets the seconds spent assigning the solution to the variables and constraints.
+        /// </summary>
+        public double AssignSeconds { get { return assignSeconds; } }
+
+        /// <summary>
+        /// Gets the number of LP iterations of the solve, for MIP in total over all nodes.
+        /// </summary>
+        public int IterationCount { get { return iterationCount; } }
+
+        /// <summary>
+        /// Gets the number of LP iterations per second of solving.
+        /// </summary>
+        public double IterationsPerSecond { get { return solveSeconds > 0.0 ? iterationCount / solveSeconds : 0.0; } }
+
+        /// <summary>
+        /// Gets the number of nodes of the branch and bound, or zero for LP.
+        /// </summary>
+        public int NodeCount { get { return nodeCount; } }
+
+        /// <summary>
+        /// Gets the seconds spent solving the root LP relaxation, before the branch and bound. 
+        /// NaN if not measured, e.g., with MIPPreProcess, or via CbcMain (without the CbcSolverArgs -branchAndBound).
+        /// </summary>
+        public double RootLPSeconds { get { return rootLPSeconds; } }
+
+        /// <summary>
+        /// Gets the seconds from the start of the branch and bound to its first node, that is, the root cut loop and root heuristics.
+        /// The first node is always recorded, whatever the TelemetryNodeInterval.
+        /// If the branch and bound ended at the root, this is the whole branch and bound. NaN if not measured.
+        /// </summary>
+        public double RootSeconds
+        {
+            get
+            {
+                lock (syncRoot)
+                {
+                    return (eventHandler != null) ? ComputeRootSeconds() : rootSeconds;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets per point of the time series the seconds since the start of the branch and bound.
+        /// </summary>
+        public double[] Seconds { get { return GetSeries().seconds; } }
+
+        /// <summary>
+        /// Gets per point of the time series the objective value of the incumbent (incl. the objective constant), or NaN if there is none yet.
+        /// </summary>
+        public double[] ObjectiveValues { get { return GetSeries().objectiveValues; } }
+
+        /// <summary>
+        /// Gets per point of the time series the best possible objective value (incl. the objective constant).
+        /// </summary>
+        public double[] BestPossibleObjValues { get { return GetSeries().bestPossibleObjValues; } }
+
+        /// <summary>
+        /// Gets per point of the time series the relative gap between the incumbent and the best possible objective value,
+        /// or NaN if there is no incumbent yet.
+        /// </summary>
+        public double[] Gaps { get { return GetSeries().gaps; } }
+
+        /// <summary>
+        /// Gets per point of the time series the number of nodes evaluated.
+        /// </summary>
+        public int[] NodeCounts { get { return GetSeries().nodeCounts; } }
+
+        /// <summary>
+        /// Gets per point of the time series the number of open nodes in the tree.
+        /// </summary>
+        public int[] OpenNodeCounts { get { return GetSeries().openNodeCounts; } }
+
+        /// <summary>
+        /// Gets per point of the time series the number of LP iterations.
+        /// </summary>
+        public int[] IterationCounts { get { return GetSeries().iterationCounts; } }
+
+        /// <summary>
+        /// Starts collecting the time series of the branch and bound of the given Cbc model.
+        /// </summary>
+        internal void Attach(CbcModel cbcModel, int nodeInterval)
+        {
+            eventHandler = new CbcEventHandler();
+            eventHandler.setRecordNodes(true);
+            eventHandler.setNodeInterval(nodeInterval);
+            cbcModel.passInEventHandler(eventHandler, true);
+        }
+
+        /// <summary>
+        /// Stops collecting, and keeps the time series and counts of the given Cbc model, if any.
+        /// </summary>
+        internal void Detach(CbcModel cbcModel)
+        {
+            // the getters can be used from another thread during the solve, so dispose the handler under the lock
+            lock (syncRoot)
+            {
+                if (eventHandler == null) return;
+
+                nodeCount = cbcModel.getNodeCount();
+                cbcModel.removeEventHandler();
+                series = ReadSeries();
+                rootSeconds = ComputeRootSeconds();
+                eventHandler.Dispose();
+                eventHandler = null;
+            }
+        }
+
+        private Series GetSeries()
+        {
+            lock (syncRoot)
+            {
+                if (eventHandler != null) return ReadSeries();
+                if (series == null) series = new Series(0);
+                return series;
+            }
+        }
+
+        private Series ReadSeries()
+        {
+            int n = eventHandler.numberEvents();
+            Series result = new Series(n);
+            for (int i = 0; i < n; i++)
+            {
+                double objectiveValue = eventHandler.eventObjectiveValue(i);
+                double bestPossible = eventHandler.eventBestPossibleObjValue(i);
+                bool hasIncumbent = Math.Abs(objectiveValue) < 1e50;
+
+                result.seconds[i] = eventHandler.eventSeconds(i);
+                result.objectiveValues[i] = hasIncumbent ? objectiveValue + objectiveConstant : double.NaN;
+                result.bestPossibleObjValues[i] = bestPossible + objectiveConstant;
+                result.gaps[i] = hasIncumbent ? Math.Abs(objectiveValue - bestPossible) / Math.Max(Math.Abs(objectiveValue), 1e-10) : double.NaN;
+                result.nodeCounts[i] = eventHandler.eventNodeCount(i);
+                result.openNodeCounts[i] = eventHandler.eventOpenNodeCount(i);
+                result.iterationCounts[i] = eventHandler.eventIterationCount(i);
+            }
+            return result;
+        }
+
+        private double ComputeRootSeconds()
+        {
+            int n = eventHandler.numberEvents();
+            for (int i = 0; i < n; i++)
+            {
+                if (eventHandler.eventType(i) == CbcEventType.Node) return eventHandler.eventSeconds(i);
+            }
+
+            // no nodes: ended at the root
+            return (n > 0 && eventHandler.eventType(n - 1) == CbcEventType.EndSearch) ? eventHandler.eventSeconds(n - 1) : double.NaN;
+        }
+
+        private class Series
+        {
+            public Series(int n)
+            {
+                seconds = new double[n];
+                objectiveValues = new double[n];
+                bestPossibleObjValues = new double[n];
+                gaps = new double[n];
+                nodeCounts = new int[n];
+                openNodeCounts = new int[n];
+                iterationCounts = new int[n];
+            }
+
+            public double[] seconds;
+            public double[] objectiveValues;
+            public double[] bestPossibleObjValues;
+            public double[] gaps;
+            public int[] nodeCounts;
+            public int[] openNodeCounts;
+            public int[] iterationCounts;
+        }
+
+        private bool isMIP;
+        private double objectiveConstant;
+        private CbcEventHandler eventHandler;
+        private readonly object syncRoot = new object();
+        private Series series;
+        private double rootSeconds;
+        internal double generateSeconds;
+        internal double solveSeconds;
+        internal double assignSeconds;
+        internal double rootLPSeconds;
+        internal int iterationCount;
+        internal int nodeCount;
+    }
+}
@@ -23,6 +23,25 @@ namespace Sonnet
         Integer
     }
 
+    /// <summary>
+    /// Specifies the preferred branch direction of an integer variable in branch and bound.
+    /// </summary>
+    public enum BranchDirection
+    {
+        /// <summary>
+        /// No preference, the solver decides
+        /// </summary>
+        Default,
+        /// <summary>
+        /// Branch down first
+        /// </summary>
+        Down,
+        /// <summary>
+        /// Branch up first
+        /// </summary>
+        Up
+    }
+
     /// <summary>
     /// The Variable class represents variables in expressions which 
     /// are use in objectives and constraints.
@@ -276,6 +295,27 @@ namespace Sonnet
             }
         }
 
+        /// <summary>
+        /// Gets or sets the branching priority of this (integer) variable in branch and bound: variables with a lower value
+        /// are branched on first. Null for the solver default (1000 for Cbc).
+        /// Only supported for OsiCbc; the priority is passed to the solver at the next MIP solve.
+        /// </summary>
+        public int? Priority
+        {
+            get { return priority; }
+            set { priority = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the preferred branch direction of this (integer) variable in branch and bound.
+        /// Only supported for OsiCbc; the direction is passed to the solver at the next MIP solve.
+        /// </summary>
+        public BranchDirection BranchDirection
+        {
+            get { return branchDirection; }
+            set { branchDirection = value; }
+        }
+
         /// <summary>
         /// Get or set the name of this constraint.
         /// </summary>
@@ -695,5 +735,8 @@ namespace Sonnet
         /// The type of the current variable.
         /// </summary>
         protected VariableType type;
+
+        private int? priority;
+        private BranchDirection branchDirection = BranchDirection.Default;
     }
 }
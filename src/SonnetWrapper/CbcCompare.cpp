@@ -0,0 +1,137 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <climits>
+#include <CbcModel.hpp>
+#include <CbcNode.hpp>
+
+#include "CbcCompare.h"
+
+#pragma managed(push, off)
+// The comparison is called for every heap operation of the tree, so keep it native.
+
+CbcCompareHybridDive::CbcCompareHybridDive()
+	: ::CbcCompareBase()
+{
+	maximumDiveDepth = INT_MAX;
+	diveNodeLimit = 0;
+	diving = true;
+	test_ = this;
+}
+
+CbcCompareHybridDive::CbcCompareHybridDive(const CbcCompareHybridDive& rhs)
+	: ::CbcCompareBase(rhs)
+{
+	maximumDiveDepth = rhs.maximumDiveDepth;
+	diveNodeLimit = rhs.diveNodeLimit;
+	diving = rhs.diving;
+	test_ = this;
+}
+
+CbcCompareHybridDive& CbcCompareHybridDive::operator=(const CbcCompareHybridDive& rhs)
+{
+	if (this != &rhs)
+	{
+		::CbcCompareBase::operator=(rhs);
+		maximumDiveDepth = rhs.maximumDiveDepth;
+		diveNodeLimit = rhs.diveNodeLimit;
+		diving = rhs.diving;
+	}
+	return *this;
+}
+
+::CbcCompareBase * CbcCompareHybridDive::clone() const
+{
+	return new CbcCompareHybridDive(*this);
+}
+
+bool CbcCompareHybridDive::test(::CbcNode * x, ::CbcNode * y)
+{
+	if (diving)
+	{
+		// the deepest node first, up to the maximum dive depth
+		int depthX = (x->depth() < maximumDiveDepth) ? x->depth() : maximumDiveDepth;
+		int depthY = (y->depth() < maximumDiveDepth) ? y->depth() : maximumDiveDepth;
+		if (depthX != depthY) return depthX < depthY;
+	}
+
+	// the best objective value (bound) first
+	double objectiveX = x->objectiveValue();
+	double objectiveY = y->objectiveValue();
+	if (objectiveX != objectiveY) return objectiveX > objectiveY;
+	return equalityTest(x, y);
+}
+
+bool CbcCompareHybridDive::newSolution(::CbcModel * model, double objectiveAtContinuous, int numberInfeasibilitiesAtContinuous)
+{
+	if (!diving) return false;
+	diving = false;
+	return true;
+}
+
+bool CbcCompareHybridDive::every1000Nodes(::CbcModel * model, int numberNodes)
+{
+	if (!diving || diveNodeLimit <= 0 || numberNodes < diveNodeLimit) return false;
+	diving = false;
+	return true;
+}
+
+void CbcCompareHybridDive::setDiveNodeLimit(int value)
+{
+	// every1000Nodes is called when the number of nodes is a multiple of 1000, so round up to the limit that is used
+	if (value <= 0) diveNodeLimit = 0;
+	else if (value > INT_MAX - 999) diveNodeLimit = INT_MAX;
+	else diveNodeLimit = (value + 999) / 1000 * 1000;
+}
+#pragma managed(pop)
+
+namespace COIN
+{
+	CbcCompareBase ^ CbcCompareBase::CreateDerived(::CbcCompareBase *derived)
+	{
+		if (dynamic_cast<::CbcCompareDefault *>(derived) != nullptr)
+		{
+			CbcCompareBase ^ result = gcnew CbcCompareDefault();
+			result->Base = (::CbcCompareDefault *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcCompareDepth *>(derived) != nullptr)
+		{
+			CbcCompareBase ^ result = gcnew CbcCompareDepth();
+			result->Base = (::CbcCompareDepth *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcCompareObjective *>(derived) != nullptr)
+		{
+			CbcCompareBase ^ result = gcnew CbcCompareObjective();
+			result->Base = (::CbcCompareObjective *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcCompareEstimate *>(derived) != nullptr)
+		{
+			CbcCompareBase ^ result = gcnew CbcCompareEstimate();
+			result->Base = (::CbcCompareEstimate *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcCompareHybridDive *>(derived) != nullptr)
+		{
+			CbcCompareBase ^ result = gcnew CbcCompareHybridDive();
+			result->Base = (::CbcCompareHybridDive *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else
+		{
+			CbcCompareBase ^ result = gcnew CbcCompareBase();
+			result->Base = (::CbcCompareBase *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		throw gcnew ArgumentException(L"Unknown CbcCompareBase", gcnew String(typeid(derived).name())); 
+	}
+}
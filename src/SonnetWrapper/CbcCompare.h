@@ -0,0 +1,148 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CbcCompareBase.hpp>
+#include <CbcCompareDefault.hpp>
+#include <CbcCompareDepth.hpp>
+#include <CbcCompareObjective.hpp>
+#include <CbcCompareEstimate.hpp>
+
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+/// A native node comparison that dives depth-first until the first solution is found, and then switches to best-bound 
+/// (the node with the best objective value first). The dive is limited by a maximum depth, and by a number of nodes 
+/// after which best-bound is used even without a solution. Wrapped by COIN::CbcCompareHybridDive.
+class CbcCompareHybridDive : public ::CbcCompareBase
+{
+public:
+	CbcCompareHybridDive();
+
+	/** The copy constructor */
+	CbcCompareHybridDive(const CbcCompareHybridDive& rhs);
+
+	/** Assignment operator. */
+	CbcCompareHybridDive& operator=(const CbcCompareHybridDive& rhs);
+
+	virtual ::CbcCompareBase * clone() const;
+
+	/// Returns true if y is better than x
+	virtual bool test(::CbcNode * x, ::CbcNode * y);
+	/// Switch to best-bound at the first solution. Returns true if the tree has to be resorted.
+	virtual bool newSolution(::CbcModel * model, double objectiveAtContinuous, int numberInfeasibilitiesAtContinuous);
+	/// Switch to best-bound after the node limit of the dive. Returns true if the tree has to be resorted.
+	virtual bool every1000Nodes(::CbcModel * model, int numberNodes);
+
+	/// Set the node limit of the dive, rounded up to a multiple of 1000 (0 or less for no limit)
+	void setDiveNodeLimit(int value);
+
+	int maximumDiveDepth;
+	int diveNodeLimit;
+	bool diving;
+};
+
+namespace COIN
+{
+	/// <summary>
+	/// The base class of the node comparisons of Cbc, which select the next node of the branch and bound tree.
+	/// Set the comparison of a model via CbcModel::setNodeComparison, which stores a copy.
+	/// </summary>
+	public ref class CbcCompareBase : WrapperAbstractBase<::CbcCompareBase>
+	{
+	public:
+		static CbcCompareBase ^ CreateDerived(::CbcCompareBase *derived);
+	};
+
+	template<class T>
+	public ref class CbcCompareGeneric : CbcCompareBase
+	{
+	public:
+		CbcCompareGeneric()
+		{
+			Base = new T();
+		}
+
+	protected:
+		property T * Base 
+		{
+			T * get() 
+			{ 
+				return dynamic_cast<T*>(CbcCompareBase::Base); 
+			} 
+		}
+	};
+
+	/// <summary>
+	/// The default node comparison of Cbc: depth-first until a solution, then a weighted mix of objective and 
+	/// number of infeasibilities, with regular dives.
+	/// </summary>
+	public ref class CbcCompareDefault : CbcCompareGeneric<::CbcCompareDefault>
+	{
+	public:
+		CbcCompareDefault() { }
+
+		/// Set the weight of the number of infeasibilities (-1.0 for depth-first until a solution)
+		void setWeight(double weight) { Base->setWeight(weight); }
+		/// Get the weight of the number of infeasibilities
+		double getWeight() { return Base->getWeight(); }
+		/// Set the depth at which to start a breadth-first (best-bound) search
+		void setBreadthDepth(int value) { Base->setBreadthDepth(value); }
+		/// Get the depth at which to start a breadth-first (best-bound) search
+		int getBreadthDepth() { return Base->getBreadthDepth(); }
+	};
+
+	/// <summary>
+	/// Depth-first node comparison: the deepest node first.
+	/// </summary>
+	public ref class CbcCompareDepth : CbcCompareGeneric<::CbcCompareDepth>
+	{
+	public:
+		CbcCompareDepth() { }
+	};
+
+	/// <summary>
+	/// Best-bound node comparison: the node with the best objective value first.
+	/// </summary>
+	public ref class CbcCompareObjective : CbcCompareGeneric<::CbcCompareObjective>
+	{
+	public:
+		CbcCompareObjective() { }
+	};
+
+	/// <summary>
+	/// Best-estimate node comparison: the node with the best estimated objective value of a solution in its subtree first.
+	/// </summary>
+	public ref class CbcCompareEstimate : CbcCompareGeneric<::CbcCompareEstimate>
+	{
+	public:
+		CbcCompareEstimate() { }
+	};
+
+	/// <summary>
+	/// Hybrid node comparison: depth-first dives until the first solution is found, and then best-bound.
+	/// A dive is limited by the maximum dive depth: deeper nodes are compared by objective value.
+	/// If no solution is found after the dive node limit, best-bound is used anyway.
+	/// </summary>
+	public ref class CbcCompareHybridDive : CbcCompareGeneric<::CbcCompareHybridDive>
+	{
+	public:
+		CbcCompareHybridDive() { }
+
+		/// Set the maximum depth of depth-first diving (default no maximum)
+		void setMaximumDiveDepth(int value) { Base->maximumDiveDepth = value; }
+		/// Get the maximum depth of depth-first diving
+		int getMaximumDiveDepth() { return Base->maximumDiveDepth; }
+		/// Set the number of nodes after which best-bound is used, even without a solution (default 0, no limit).
+		/// Cbc only checks the limit every 1000 nodes, so the limit is rounded up to a multiple of 1000 (e.g., 1 becomes 1000).
+		void setDiveNodeLimit(int value) { Base->setDiveNodeLimit(value); }
+		/// Get the number of nodes after which best-bound is used, even without a solution
+		int getDiveNodeLimit() { return Base->diveNodeLimit; }
+		/// Get whether the comparison is still diving depth-first
+		bool isDiving() { return Base->diving; }
+	};
+}
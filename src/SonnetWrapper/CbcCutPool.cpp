@@ -0,0 +1,115 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cmath>
+#include <OsiSolverInterface.hpp>
+#include <OsiRowCut.hpp>
+#include <CbcCountRowCut.hpp>
+
+#include "CbcCutPool.h"
+
+namespace COIN
+{
+#pragma managed(push, off)
+	CbcCutBlock::CbcCutBlock()
+	{
+		starts.push_back(0);
+	}
+
+	void CbcCutBlock::appendRows(const ::OsiSolverInterface * solver, int firstRow)
+	{
+		int m = solver->getNumRows();
+		const double * lower = solver->getRowLower();
+		const double * upper = solver->getRowUpper();
+		const ::CoinPackedMatrix * matrix = solver->getMatrixByRow();
+		for (int i = firstRow; i < m; i++)
+		{
+			const ::CoinShallowPackedVector row = matrix->getVector(i);
+			columns.insert(columns.end(), row.getIndices(), row.getIndices() + row.getNumElements());
+			elements.insert(elements.end(), row.getElements(), row.getElements() + row.getNumElements());
+			starts.push_back((int)columns.size());
+			rowLower.push_back(lower[i]);
+			rowUpper.push_back(upper[i]);
+		}
+	}
+
+	void CbcCutBlock::appendCuts(::CbcRowCuts * pool)
+	{
+		if (pool == nullptr) return;
+
+		for (int i = 0; i < pool->sizeRowCuts(); i++)
+		{
+			const ::OsiRowCut * cut = pool->rowCutPtr(i);
+			const ::CoinPackedVector & row = cut->row();
+			columns.insert(columns.end(), row.getIndices(), row.getIndices() + row.getNumElements());
+			elements.insert(elements.end(), row.getElements(), row.getElements() + row.getNumElements());
+			starts.push_back((int)columns.size());
+			rowLower.push_back(cut->lb());
+			rowUpper.push_back(cut->ub());
+		}
+	}
+#pragma managed(pop)
+
+	CbcCutPool::CbcCutPool(array<int> ^ starts, array<int> ^ columns, array<double> ^ elements, array<double> ^ rowLower, array<double> ^ rowUpper, array<double> ^ activities)
+	{
+		if (starts == nullptr) throw gcnew ArgumentNullException("starts");
+		if (columns == nullptr) throw gcnew ArgumentNullException("columns");
+		if (elements == nullptr) throw gcnew ArgumentNullException("elements");
+		if (rowLower == nullptr) throw gcnew ArgumentNullException("rowLower");
+		if (rowUpper == nullptr) throw gcnew ArgumentNullException("rowUpper");
+
+		int m = rowLower->Length;
+		if (rowUpper->Length != m || starts->Length != m + 1) throw gcnew ArgumentException("The starts and bounds should have a value per cut.");
+		if (activities != nullptr && activities->Length != m) throw gcnew ArgumentException("The activities should have a value per cut.", "activities");
+		if (elements->Length != columns->Length || starts[0] != 0 || starts[m] != columns->Length) throw gcnew ArgumentException("The starts do not fit the columns and elements.");
+
+		this->starts = starts;
+		this->columns = columns;
+		this->elements = elements;
+		this->rowLower = rowLower;
+		this->rowUpper = rowUpper;
+		this->activities = activities;
+	}
+
+	CbcCutPool ^ CbcCutPool::Create(const CbcCutBlock & block, const double * solution)
+	{
+		int numberCuts = block.numberCuts();
+		int numberElements = (int)block.columns.size();
+		array<int> ^ starts = gcnew array<int>(numberCuts + 1);
+		array<int> ^ columns = gcnew array<int>(numberElements);
+		array<double> ^ elements = gcnew array<double>(numberElements);
+		array<double> ^ rowLower = gcnew array<double>(numberCuts);
+		array<double> ^ rowUpper = gcnew array<double>(numberCuts);
+		array<double> ^ activities = (solution != nullptr) ? gcnew array<double>(numberCuts) : nullptr;
+
+		Marshal::Copy(IntPtr((void *)&block.starts[0]), starts, 0, numberCuts + 1);
+		if (numberElements > 0)
+		{
+			Marshal::Copy(IntPtr((void *)&block.columns[0]), columns, 0, numberElements);
+			Marshal::Copy(IntPtr((void *)&block.elements[0]), elements, 0, numberElements);
+		}
+		if (numberCuts > 0)
+		{
+			Marshal::Copy(IntPtr((void *)&block.rowLower[0]), rowLower, 0, numberCuts);
+			Marshal::Copy(IntPtr((void *)&block.rowUpper[0]), rowUpper, 0, numberCuts);
+		}
+		for (int i = 0; activities != nullptr && i < numberCuts; i++)
+		{
+			double activity = 0.0;
+			for (int k = block.starts[i]; k < block.starts[i + 1]; k++) activity += block.elements[k] * solution[block.columns[k]];
+			activities[i] = activity;
+		}
+
+		return gcnew CbcCutPool(starts, columns, elements, rowLower, rowUpper, activities);
+	}
+
+	bool CbcCutPool::isTight(int i, double tolerance)
+	{
+		if (i < 0 || i >= numberCuts()) throw gcnew ArgumentOutOfRangeException("i");
+		if (activities == nullptr) return true;
+
+		double activity = activities[i];
+		return std::fabs(activity - rowLower[i]) <= tolerance || std::fabs(rowUpper[i] - activity) <= tolerance;
+	}
+}
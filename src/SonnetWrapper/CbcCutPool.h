@@ -0,0 +1,84 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <vector>
+
+class OsiSolverInterface;
+class CbcRowCuts;
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// A block of cuts in packed row format, collected natively from the rows of a solver or a cut pool of Cbc.
+	class CbcCutBlock
+	{
+	public:
+		CbcCutBlock();
+
+		/// Append the rows of the solver from firstRow on
+		void appendRows(const ::OsiSolverInterface * solver, int firstRow);
+		/// Append the cuts of the given cut pool, if any
+		void appendCuts(::CbcRowCuts * pool);
+
+		int numberCuts() const { return (int)rowLower.size(); }
+
+		std::vector<int> starts;
+		std::vector<int> columns;
+		std::vector<double> elements;
+		std::vector<double> rowLower;
+		std::vector<double> rowUpper;
+	};
+
+	/// <summary>
+	/// A block of cuts (rows) in packed row format, for example the cuts of a branch and bound, extracted via CbcModel::getCuts. 
+	/// Cut i has the columns[starts[i]..starts[i + 1]) with elements[starts[i]..starts[i + 1]), and 
+	/// rowLower[i] &lt;= cut &lt;= rowUpper[i]. The activity of each cut at the solution of extraction is kept, 
+	/// so that cuts that were not tight can be purged when added to a model via CbcModel::addCuts.
+	/// </summary>
+	public ref class CbcCutPool
+	{
+	public:
+		/// Create a block of the given cuts, with starts of length number of cuts + 1. 
+		/// The activities can be null, if unknown: then all cuts are considered tight.
+		CbcCutPool(array<int> ^ starts, array<int> ^ columns, array<double> ^ elements, array<double> ^ rowLower, array<double> ^ rowUpper, array<double> ^ activities);
+
+		/// Get the number of cuts
+		int numberCuts() { return rowLower->Length; }
+		/// Get the number of elements of all cuts
+		int numberElements() { return columns->Length; }
+
+		/// Get the start of each cut in columns and elements, plus the end of the last cut
+		array<int> ^ getStarts() { return starts; }
+		/// Get the columns of the elements
+		array<int> ^ getColumns() { return columns; }
+		/// Get the elements
+		array<double> ^ getElements() { return elements; }
+		/// Get the lower bound of each cut
+		array<double> ^ getRowLower() { return rowLower; }
+		/// Get the upper bound of each cut
+		array<double> ^ getRowUpper() { return rowUpper; }
+		/// Get the activity of each cut at the solution of extraction, or null if unknown
+		array<double> ^ getActivities() { return activities; }
+
+		/// Returns whether the given cut was tight (at its lower or upper bound, within the tolerance) at the solution of extraction.
+		/// If the activities are unknown, this returns true.
+		bool isTight(int i, double tolerance);
+
+	internal:
+		/// Create a copy of the given block, with the activities of the cuts at the given solution (null if unknown)
+		static CbcCutPool ^ Create(const CbcCutBlock & block, const double * solution);
+
+	private:
+		array<int> ^ starts;
+		array<int> ^ columns;
+		array<double> ^ elements;
+		array<double> ^ rowLower;
+		array<double> ^ rowUpper;
+		array<double> ^ activities;
+	};
+}
@@ -0,0 +1,427 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <intrin.h>
+#include <CbcModel.hpp>
+#include <CbcTree.hpp>
+
+#include "CbcEventHandler.h"
+
+namespace COIN
+{
+#pragma managed(push, off)
+	// The recording is native code, such that Cbc doesnt transition to managed code per event.
+
+	CbcEventQueue::CbcEventQueue()
+	{
+		recordNodes = false;
+		nodeInterval = 1;
+		batchSize = 0;
+		stopAfterSolutions = 0;
+		stopAtGap = -1.0;
+		callback = nullptr;
+		stopFlag = 0;
+		solveEnded = false;
+		lockFlag = 0;
+		firstPending = 0;
+		skippedNodes = 0;
+		firstNodeRecorded = false;
+	}
+
+	CbcEventQueue::~CbcEventQueue()
+	{
+		clear();
+	}
+
+	void CbcEventQueue::lock()
+	{
+		while (_InterlockedCompareExchange(&lockFlag, 1, 0) != 0) _mm_pause();
+	}
+
+	void CbcEventQueue::unlock()
+	{
+		_InterlockedExchange(&lockFlag, 0);
+	}
+
+	void CbcEventQueue::add(int type, ::CbcModel * model, bool withSolution)
+	{
+		CbcEventRecord record;
+		record.type = type;
+		record.nodeCount = model->getNodeCount();
+		record.openNodeCount = model->tree() != nullptr ? model->tree()->size() : 0;
+		record.iterationCount = model->getIterationCount();
+		record.seconds = model->getCurrentSeconds();
+		record.objectiveValue = model->getObjValue();
+		record.bestPossibleObjValue = model->getBestPossibleObjValue();
+		record.solution = -1;
+
+		double * values = nullptr;
+		int length = 0;
+		if (withSolution && model->bestSolution() != nullptr)
+		{
+			// copy outside the lock
+			length = model->getNumCols();
+			values = new double[length];
+			memcpy(values, model->bestSolution(), length * sizeof(double));
+		}
+
+		lock();
+		if (values != nullptr)
+		{
+			record.solution = (int)solutions.size();
+			solutions.push_back(values);
+			solutionLengths.push_back(length);
+		}
+		records.push_back(record);
+		unlock();
+	}
+
+	bool CbcEventQueue::sampleNode()
+	{
+		if (!recordNodes) return false;
+		if (!firstNodeRecorded)
+		{
+			firstNodeRecorded = true;
+			skippedNodes = 0;
+			return true;
+		}
+		if (++skippedNodes < nodeInterval) return false;
+		skippedNodes = 0;
+		return true;
+	}
+
+	bool CbcEventQueue::takePending(bool force, int * first, int * count)
+	{
+		lock();
+		int n = (int)records.size() - firstPending;
+		bool result = n > 0 && (force || n >= batchSize);
+		if (result)
+		{
+			*first = firstPending;
+			*count = n;
+			firstPending += n;
+		}
+		unlock();
+		return result;
+	}
+
+	bool CbcEventQueue::acceptable(::CbcModel * model)
+	{
+		if (stopAfterSolutions > 0 && numberSolutions() >= stopAfterSolutions) return true;
+		if (stopAtGap >= 0.0 && model->bestSolution() != nullptr)
+		{
+			double objectiveValue = model->getObjValue();
+			double gap = fabs(objectiveValue - model->getBestPossibleObjValue()) / CoinMax(fabs(objectiveValue), 1.0e-10);
+			if (gap <= stopAtGap) return true;
+		}
+		return false;
+	}
+
+	int CbcEventQueue::numberRecords()
+	{
+		lock();
+		int result = (int)records.size();
+		unlock();
+		return result;
+	}
+
+	CbcEventRecord CbcEventQueue::record(int i)
+	{
+		lock();
+		CbcEventRecord result = records[i];
+		unlock();
+		return result;
+	}
+
+	int CbcEventQueue::numberSolutions()
+	{
+		lock();
+		int result = (int)solutions.size();
+		unlock();
+		return result;
+	}
+
+	const double * CbcEventQueue::solution(int i, int * length)
+	{
+		lock();
+		const double * result = solutions[i];
+		*length = solutionLengths[i];
+		unlock();
+		return result;
+	}
+
+	void CbcEventQueue::clear()
+	{
+		lock();
+		for (size_t i = 0; i < solutions.size(); i++) delete[] solutions[i];
+		solutions.clear();
+		solutionLengths.clear();
+		records.clear();
+		firstPending = 0;
+		skippedNodes = 0;
+		firstNodeRecorded = false;
+		solveEnded = false;
+		unlock();
+	}
+
+	CbcChainedEventHandler::CbcChainedEventHandler(const ::CbcEventHandler *chained)
+		: ::CbcEventHandler()
+	{
+		this->chained = chained != nullptr ? chained->clone() : nullptr;
+	}
+
+	CbcChainedEventHandler::CbcChainedEventHandler(const CbcChainedEventHandler& rhs)
+		: ::CbcEventHandler(rhs)
+	{
+		this->chained = rhs.chained != nullptr ? rhs.chained->clone() : nullptr;
+	}
+
+	CbcChainedEventHandler& CbcChainedEventHandler::operator=(const CbcChainedEventHandler& rhs)
+	{
+		if (this != &rhs)
+		{
+			::CbcEventHandler::operator=(rhs);
+			setChainedHandler(rhs.chained);
+		}
+		return *this;
+	}
+
+	CbcChainedEventHandler::~CbcChainedEventHandler()
+	{
+		delete chained;
+	}
+
+	void CbcChainedEventHandler::setChainedHandler(const ::CbcEventHandler *handler)
+	{
+		::CbcEventHandler * copy = handler != nullptr ? handler->clone() : nullptr;
+		delete chained;
+		chained = copy;
+	}
+
+	::CbcEventHandler::CbcAction CbcChainedEventHandler::chainedEvent(CbcEvent whichEvent)
+	{
+		if (chained == nullptr) return noAction;
+
+		// the model is set on this handler by CbcModel::passInEventHandler, and may have been copied since
+		chained->setModel(model_);
+		return chained->event(whichEvent);
+	}
+
+	CbcEventHandlerProxy::CbcEventHandlerProxy(CbcEventQueue *queue)
+		: CbcChainedEventHandler(nullptr)
+	{
+		this->queue = queue;
+	}
+
+	CbcEventHandlerProxy::CbcEventHandlerProxy(const CbcEventHandlerProxy& rhs)
+		: CbcChainedEventHandler(rhs)
+	{
+		this->queue = rhs.queue;
+	}
+
+	CbcEventHandlerProxy& CbcEventHandlerProxy::operator=(const CbcEventHandlerProxy& rhs)
+	{
+		if (this != &rhs)
+		{
+			CbcChainedEventHandler::operator=(rhs);
+			this->queue = rhs.queue;
+		}
+		return *this;
+	}
+
+	::CbcEventHandler * CbcEventHandlerProxy::clone() const
+	{
+		return new CbcEventHandlerProxy(*this);
+	}
+
+	::CbcEventHandler::CbcAction CbcEventHandlerProxy::event(CbcEvent whichEvent)
+	{
+		// the records, incumbents and counts are per solve, so that stopAfterSolutions does not count earlier solves
+		if (queue->solveEnded) queue->clear();
+
+		bool isSolution = whichEvent == solution || whichEvent == heuristicSolution;
+		bool isEnd = whichEvent == endSearch;
+		// the nodes of the sub branch and bound of a heuristic are not recorded
+		bool isNode = whichEvent == node && model_->parentModel() == nullptr;
+		if (isSolution || isEnd || (isNode && queue->sampleNode())) queue->add(whichEvent, model_, isSolution);
+		else if (queue->stopFlag != 0) return stop;
+		else return chainedEvent(whichEvent);
+
+		int first, count;
+		if (queue->callback != nullptr && queue->takePending(isSolution || isEnd, &first, &count))
+		{
+			if (queue->callback(first, count) != 0) _InterlockedExchange(&queue->stopFlag, 1);
+		}
+
+		// the sub branch and bound of a heuristic has a parent model, and does not end the solve
+		if (isEnd && model_->parentModel() == nullptr) queue->solveEnded = true;
+
+		if (!isEnd && queue->stopFlag != 0) return stop;
+		if (isSolution && queue->acceptable(model_)) return stop;
+		return chainedEvent(whichEvent);
+	}
+
+	CbcStopEventHandler::CbcStopEventHandler(volatile long *stopFlag, const ::CbcEventHandler *chained)
+		: CbcChainedEventHandler(chained)
+	{
+		this->stopFlag = stopFlag;
+	}
+
+	CbcStopEventHandler::CbcStopEventHandler(const CbcStopEventHandler& rhs)
+		: CbcChainedEventHandler(rhs)
+	{
+		this->stopFlag = rhs.stopFlag;
+	}
+
+	CbcStopEventHandler& CbcStopEventHandler::operator=(const CbcStopEventHandler& rhs)
+	{
+		if (this != &rhs)
+		{
+			CbcChainedEventHandler::operator=(rhs);
+			this->stopFlag = rhs.stopFlag;
+		}
+		return *this;
+	}
+
+	::CbcEventHandler * CbcStopEventHandler::clone() const
+	{
+		return new CbcStopEventHandler(*this);
+	}
+
+	::CbcEventHandler::CbcAction CbcStopEventHandler::event(CbcEvent whichEvent)
+	{
+		if (*stopFlag != 0 && whichEvent != endSearch) return stop;
+		return chainedEvent(whichEvent);
+	}
+
+	CbcRootCutsEventHandler::CbcRootCutsEventHandler(CbcRootCuts *cuts, const ::CbcEventHandler *chained)
+		: CbcChainedEventHandler(chained)
+	{
+		this->cuts = cuts;
+	}
+
+	CbcRootCutsEventHandler::CbcRootCutsEventHandler(const CbcRootCutsEventHandler& rhs)
+		: CbcChainedEventHandler(rhs)
+	{
+		this->cuts = rhs.cuts;
+	}
+
+	CbcRootCutsEventHandler& CbcRootCutsEventHandler::operator=(const CbcRootCutsEventHandler& rhs)
+	{
+		if (this != &rhs)
+		{
+			CbcChainedEventHandler::operator=(rhs);
+			this->cuts = rhs.cuts;
+		}
+		return *this;
+	}
+
+	::CbcEventHandler * CbcRootCutsEventHandler::clone() const
+	{
+		return new CbcRootCutsEventHandler(*this);
+	}
+
+	::CbcEventHandler::CbcAction CbcRootCutsEventHandler::event(CbcEvent whichEvent)
+	{
+		// the sub branch and bound of a heuristic has a parent model, and its own cuts.
+		// After the root, the rows of the solver are the cuts of the current node, which may only be valid in its subtree.
+		bool atRoot = whichEvent == node || whichEvent == treeStatus || (whichEvent == endSearch && model_->getNodeCount() == 0);
+		if (!cuts->recorded && atRoot && model_->parentModel() == nullptr)
+		{
+			cuts->cuts.appendRows(model_->solver(), model_->numberRowsAtContinuous());
+			cuts->recorded = true;
+		}
+		return chainedEvent(whichEvent);
+	}
+#pragma managed(pop)
+
+	CbcEventHandler::CbcEventHandler()
+	{
+		queue = new CbcEventQueue();
+		base = new CbcEventHandlerProxy(queue);
+		disposed = 0;
+	}
+
+	void CbcEventHandler::setBatchSize(int value)
+	{
+		queue->batchSize = value;
+		if (value > 0 && callback == nullptr)
+		{
+			// the delegate is kept alive by this object, and the function pointer is valid as long as the delegate is
+			callback = gcnew BatchCallback(this, &CbcEventHandler::OnBatch);
+			queue->callback = (CbcEventBatchCallback)Marshal::GetFunctionPointerForDelegate(callback).ToPointer();
+		}
+		else if (value <= 0)
+		{
+			queue->callback = nullptr;
+			callback = nullptr;
+		}
+	}
+
+	int CbcEventHandler::OnBatch(int first, int count)
+	{
+		// exceptions cannot pass through the native branch and bound: stop it instead
+		try
+		{
+			return onEvents(first, count) ? 1 : 0;
+		}
+		catch (Exception ^ e)
+		{
+			exception = e;
+			return 1;
+		}
+	}
+
+	void CbcEventHandler::flush()
+	{
+		int first, count;
+		if (queue->takePending(true, &first, &count))
+		{
+			if (OnBatch(first, count) != 0) stop();
+		}
+	}
+
+	void CbcEventHandler::stop()
+	{
+		_InterlockedExchange(&queue->stopFlag, 1);
+	}
+
+	void CbcEventHandler::reset()
+	{
+		_InterlockedExchange(&queue->stopFlag, 0);
+		exception = nullptr;
+	}
+
+	CbcEventRecord CbcEventHandler::record(int i)
+	{
+		if (i < 0 || i >= queue->numberRecords()) throw gcnew ArgumentOutOfRangeException("i");
+		return queue->record(i);
+	}
+
+	int CbcEventHandler::getSolutionLength(int i)
+	{
+		if (i < 0 || i >= queue->numberSolutions()) throw gcnew ArgumentOutOfRangeException("i");
+		int length;
+		queue->solution(i, &length);
+		return length;
+	}
+
+	double * CbcEventHandler::getSolutionUnsafe(int i)
+	{
+		if (i < 0 || i >= queue->numberSolutions()) throw gcnew ArgumentOutOfRangeException("i");
+		int length;
+		return (double *)queue->solution(i, &length);
+	}
+
+	array<double> ^ CbcEventHandler::getSolution(int i)
+	{
+		if (i < 0 || i >= queue->numberSolutions()) throw gcnew ArgumentOutOfRangeException("i");
+		int length;
+		const double * values = queue->solution(i, &length);
+
+		array<double> ^ result = gcnew array<double>(length);
+		if (length > 0) Marshal::Copy(IntPtr((void *)values), result, 0, length);
+		return result;
+	}
+}
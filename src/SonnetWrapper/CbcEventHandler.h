@@ -0,0 +1,365 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <vector>
+#include <CbcEventHandler.hpp>
+
+#include "ClpEventHandler.h"
+#include "CbcCutPool.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+class CbcModel;
+
+namespace COIN
+{
+	/// <summary>
+	/// The type of a recorded Cbc event
+	/// </summary>
+	public enum class CbcEventType
+	{
+		/// <summary>
+		/// A node was processed
+		/// </summary>
+		Node = ::CbcEventHandler::node,
+		/// <summary>
+		/// A new incumbent was found in the tree
+		/// </summary>
+		Solution = ::CbcEventHandler::solution,
+		/// <summary>
+		/// A new incumbent was found by a heuristic
+		/// </summary>
+		HeuristicSolution = ::CbcEventHandler::heuristicSolution,
+		/// <summary>
+		/// The branch and bound ended
+		/// </summary>
+		EndSearch = ::CbcEventHandler::endSearch
+	};
+
+	/// One recorded event. The objective values are in the sense of the model, and 1e50 (or larger) if there is no incumbent yet.
+	struct CbcEventRecord
+	{
+		int type;
+		int nodeCount;
+		int openNodeCount;
+		int iterationCount;
+		double seconds;
+		double objectiveValue;
+		double bestPossibleObjValue;
+		int solution;
+	};
+
+	/// The batch callback: receives the first record and the number of records, and returns non-zero to stop.
+	typedef int (__stdcall *CbcEventBatchCallback)(int first, int count);
+
+	/// <summary>
+	/// This class is a native queue of the events recorded by CbcEventHandlerProxy, shared by all clones of the proxy.
+	/// Records are appended by the thread running the branch and bound, and can be read concurrently from other threads.
+	/// The incumbents are stored natively, and stay at the same address until clear().
+	/// The records and incumbents of a solve are kept until the first event of the next solve, which clears them.
+	/// </summary>
+	class CbcEventQueue
+	{
+	public:
+		CbcEventQueue();
+		~CbcEventQueue();
+
+		/// Append a record for the given event, with a copy of the incumbent of the model if withSolution
+		void add(int type, ::CbcModel * model, bool withSolution);
+		/// Returns true if this node event is to be recorded, given recordNodes and nodeInterval.
+		/// The first node of a solve, the end of the root, is always recorded.
+		bool sampleNode();
+		/// Get the records not yet passed to the callback, if there are at least batchSize of them (or any, if force)
+		bool takePending(bool force, int * first, int * count);
+		/// Returns true if the incumbent of the model satisfies stopAfterSolutions or stopAtGap
+		bool acceptable(::CbcModel * model);
+
+		int numberRecords();
+		CbcEventRecord record(int i);
+		int numberSolutions();
+		const double * solution(int i, int * length);
+		void clear();
+
+		bool recordNodes;
+		int nodeInterval;
+		int batchSize;
+		int stopAfterSolutions;
+		double stopAtGap;
+		CbcEventBatchCallback callback;
+		volatile long stopFlag;
+		/// Set at the end of a solve, so the first event of the next solve clears the queue
+		bool solveEnded;
+
+	private:
+		void lock();
+		void unlock();
+
+		volatile long lockFlag;
+		int firstPending;
+		int skippedNodes;
+		bool firstNodeRecorded;
+		std::vector<CbcEventRecord> records;
+		std::vector<double *> solutions;
+		std::vector<int> solutionLengths;
+	};
+
+	/// <summary>
+	/// This class is a native class derived from native CbcEventHandler.
+	/// It passes the events it doesnt act upon to the chained handler, if any, which is typically the handler the model had before.
+	/// This way, several handlers can be used at once.
+	/// </summary>
+	class CbcChainedEventHandler : public ::CbcEventHandler
+	{
+	public:
+		CbcChainedEventHandler(const ::CbcEventHandler *chained);
+
+		/** The copy constructor */
+		CbcChainedEventHandler(const CbcChainedEventHandler& rhs);
+
+		/** Assignment operator. */
+		CbcChainedEventHandler& operator=(const CbcChainedEventHandler& rhs);
+
+		virtual ~CbcChainedEventHandler();
+
+		/// Get the chained handler, or null
+		const ::CbcEventHandler * chainedHandler() const { return chained; }
+		/// Set (a copy of) the chained handler, or null
+		void setChainedHandler(const ::CbcEventHandler *handler);
+
+	protected:
+		/// Pass the event to the chained handler, if any
+		CbcAction chainedEvent(CbcEvent whichEvent);
+
+	private:
+		::CbcEventHandler *chained;
+	};
+
+	/// <summary>
+	/// This class is a native class derived from native CbcEventHandler.
+	/// It records node, solution and heuristic solution events in the given queue, and returns stop once the stop flag
+	/// of the queue is raised, the batch callback returns non-zero, or an incumbent is acceptable.
+	/// Otherwise, the event is passed to the chained handler, if any.
+	/// The event method is compiled as native code, so there is no transition to managed code per node; 
+	/// managed code is only called per batch of events.
+	/// The queue is owned by the caller, is shared by all clones of the handler, and must outlive them.
+	/// </summary>
+	class CbcEventHandlerProxy : public CbcChainedEventHandler
+	{
+	public:
+		CbcEventHandlerProxy(CbcEventQueue *queue);
+
+		/** The copy constructor */
+		CbcEventHandlerProxy(const CbcEventHandlerProxy& rhs);
+
+		/** Assignment operator. */
+		CbcEventHandlerProxy& operator=(const CbcEventHandlerProxy& rhs);
+
+		/// Clone
+		virtual ::CbcEventHandler * clone() const;
+
+		virtual CbcAction event(CbcEvent whichEvent);
+
+	private:
+		CbcEventQueue *queue;
+	};
+
+	/// <summary>
+	/// This class is a native class derived from native CbcEventHandler.
+	/// It stops the branch and bound at the next event once the given stop flag is non-zero. 
+	/// Otherwise, the event is passed to the chained handler, if any, which is the handler the model had before.
+	/// The stop flag is owned by the caller, is shared by all clones of the handler, and must outlive them.
+	/// </summary>
+	class CbcStopEventHandler : public CbcChainedEventHandler
+	{
+	public:
+		CbcStopEventHandler(volatile long *stopFlag, const ::CbcEventHandler *chained);
+
+		/** The copy constructor */
+		CbcStopEventHandler(const CbcStopEventHandler& rhs);
+
+		/** Assignment operator. */
+		CbcStopEventHandler& operator=(const CbcStopEventHandler& rhs);
+
+		/// Clone
+		virtual ::CbcEventHandler * clone() const;
+
+		virtual CbcAction event(CbcEvent whichEvent);
+
+	private:
+		volatile long *stopFlag;
+	};
+
+	/// The cuts of a model at the end of the root, recorded by CbcRootCutsEventHandler
+	struct CbcRootCuts
+	{
+		CbcRootCuts() : recorded(false) { }
+
+		CbcCutBlock cuts;
+		bool recorded;
+	};
+
+	/// <summary>
+	/// This class is a native class derived from native CbcEventHandler.
+	/// It records the cuts of the model at the end of the root (the first node event), that is, the rows added to the 
+	/// continuous model, since the branch and bound removes them from the solver during the tree search.
+	/// If the branch and bound ends without a tree, the rows at its end are recorded instead.
+	/// The event is always passed to the chained handler, if any.
+	/// The cuts are owned by the caller, are shared by all clones of the handler, and must outlive them.
+	/// </summary>
+	class CbcRootCutsEventHandler : public CbcChainedEventHandler
+	{
+	public:
+		CbcRootCutsEventHandler(CbcRootCuts *cuts, const ::CbcEventHandler *chained);
+
+		/** The copy constructor */
+		CbcRootCutsEventHandler(const CbcRootCutsEventHandler& rhs);
+
+		/** Assignment operator. */
+		CbcRootCutsEventHandler& operator=(const CbcRootCutsEventHandler& rhs);
+
+		/// Clone
+		virtual ::CbcEventHandler * clone() const;
+
+		virtual CbcAction event(CbcEvent whichEvent);
+
+	private:
+		CbcRootCuts *cuts;
+	};
+
+	/// <summary>
+	/// The CbcEventHandler records the events of a running branch and bound of a CbcModel into a native queue:
+	/// processed nodes (if setRecordNodes), and new incumbents found in the tree or by heuristics.
+	/// Pass it to the model via CbcModel::passInEventHandler, which stores a copy that shares the queue, 
+	/// and optionally chains the handler the model had before.
+	/// Keep this object alive (and not disposed) while the model can use it.
+	/// 
+	/// The recorded events can be polled, also from another thread during the solve, via numberEvents() and the event accessors.
+	/// Alternatively, derive from this class and override onEvents, which is called with batches of (setBatchSize) events,
+	/// and at once for each new incumbent. 
+	/// The branch and bound is stopped as soon as stop() is called, onEvents returns true, or a new incumbent
+	/// satisfies setStopAfterSolutions or setStopAtGap.
+	/// </summary>
+	public ref class CbcEventHandler : public IDisposable
+	{
+	public:
+		CbcEventHandler();
+
+		/// Set whether to record processed nodes, or only solutions (default)
+		void setRecordNodes(bool value) { queue->recordNodes = value; }
+		/// Get whether to record processed nodes
+		bool recordNodes() { return queue->recordNodes; }
+
+		/// Set to record only every so many processed nodes (default 1: all nodes), if recording nodes
+		void setNodeInterval(int value) { queue->nodeInterval = Math::Max(value, 1); }
+		/// Get the interval of recorded nodes
+		int nodeInterval() { return queue->nodeInterval; }
+
+		/// Set the number of events per call of onEvents. Zero (default) means no calls, only polling.
+		void setBatchSize(int value);
+		/// Get the number of events per call of onEvents
+		int batchSize() { return queue->batchSize; }
+
+		/// Set to stop once this many incumbents were found (default 0: no limit)
+		void setStopAfterSolutions(int value) { queue->stopAfterSolutions = value; }
+		/// Get the number of incumbents after which to stop
+		int stopAfterSolutions() { return queue->stopAfterSolutions; }
+
+		/// Set to stop once an incumbent is found within this relative gap of the best possible objective value (default -1: never)
+		void setStopAtGap(double value) { queue->stopAtGap = value; }
+		/// Get the relative gap at which to stop
+		double stopAtGap() { return queue->stopAtGap; }
+
+		/// Request the branch and bound to stop at its next event. Can be called from any thread.
+		void stop();
+		/// Returns true if stop() was called since the last reset()
+		bool isStopRequested() { return queue->stopFlag != 0; }
+		/// Reset the stop request
+		void reset();
+
+		/// Get the number of recorded events
+		int numberEvents() { return queue->numberRecords(); }
+		/// Get the type of the given event
+		CbcEventType eventType(int i) { return (CbcEventType)record(i).type; }
+		/// Get the number of nodes processed at the given event
+		int eventNodeCount(int i) { return record(i).nodeCount; }
+		/// Get the number of open nodes of the tree at the given event
+		int eventOpenNodeCount(int i) { return record(i).openNodeCount; }
+		/// Get the number of LP iterations at the given event
+		int eventIterationCount(int i) { return record(i).iterationCount; }
+		/// Get the number of seconds since the start of the branch and bound at the given event
+		double eventSeconds(int i) { return record(i).seconds; }
+		/// Get the objective value of the incumbent at the given event
+		double eventObjectiveValue(int i) { return record(i).objectiveValue; }
+		/// Get the best possible objective value at the given event
+		double eventBestPossibleObjValue(int i) { return record(i).bestPossibleObjValue; }
+		/// Get the index of the incumbent stored at the given event, or -1
+		int eventSolution(int i) { return record(i).solution; }
+
+		/// Get the number of stored incumbents
+		int numberSolutions() { return queue->numberSolutions(); }
+		/// Get the number of values of the given stored incumbent (the number of columns of the solver)
+		int getSolutionLength(int i);
+		/// Get the values of the given stored incumbent, without copying. The values are valid until clear(), the next solve or dispose.
+		double * getSolutionUnsafe(int i);
+		/// Get a copy of the values of the given stored incumbent
+		array<double> ^ getSolution(int i);
+
+		/// Pass the events not yet passed to onEvents, if any. For example, after the solve if the last batch was incomplete.
+		void flush();
+
+		/// Remove all recorded events and incumbents. Do not use during a solve.
+		/// This is done automatically at the first event of each solve after the first.
+		void clear() { queue->clear(); }
+
+		/// Get the exception thrown by onEvents, if any. Such an exception stops the branch and bound.
+		Exception ^ callbackException() { return exception; }
+
+	internal:
+		property ::CbcEventHandler * Base
+		{
+			::CbcEventHandler * get()
+			{
+				return base;
+			}
+		}
+
+	protected:
+		/// Called with a batch of recorded events (first and count), on the thread of the branch and bound. 
+		/// Return true to stop the branch and bound.
+		virtual bool onEvents(int first, int count) { return false; }
+
+	private:
+		[UnmanagedFunctionPointer(CallingConvention::StdCall)]
+		delegate int BatchCallback(int first, int count);
+
+		int OnBatch(int first, int count);
+		CbcEventRecord record(int i);
+
+		CbcEventQueue * queue;
+		CbcEventHandlerProxy * base;
+		BatchCallback ^ callback;
+		Exception ^ exception;
+
+		int disposed;
+		~CbcEventHandler()
+		{
+			if (disposed > 0) return;
+			disposed++;
+
+			this->!CbcEventHandler();
+		}
+
+		!CbcEventHandler()
+		{
+			delete base;
+			base = nullptr;
+			delete queue;
+			queue = nullptr;
+		}
+	};
+}
@@ -0,0 +1,71 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <CbcModel.hpp>
+
+#include "CbcHeuristic.h"
+#include "CbcModel.h"
+
+namespace COIN
+{
+	CbcHeuristic ^ CbcHeuristic::CreateDerived(::CbcHeuristic *derived)
+	{
+		if (dynamic_cast<::CbcRounding *>(derived))
+		{
+			CbcHeuristic ^ result = gcnew CbcRounding();
+			result->Base = (::CbcRounding *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcHeuristicFPump *>(derived))
+		{
+			CbcHeuristic ^ result = gcnew CbcHeuristicFPump();
+			result->Base = (::CbcHeuristicFPump *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcHeuristicRINS *>(derived))
+		{
+			CbcHeuristic ^ result = gcnew CbcHeuristicRINS();
+			result->Base = (::CbcHeuristicRINS *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcHeuristicDiveCoefficient *>(derived))
+		{
+			CbcHeuristic ^ result = gcnew CbcHeuristicDiveCoefficient();
+			result->Base = (::CbcHeuristicDiveCoefficient *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcHeuristicLocal *>(derived))
+		{
+			CbcHeuristic ^ result = gcnew CbcHeuristicLocal();
+			result->Base = (::CbcHeuristicLocal *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else
+		{
+			CbcHeuristic ^ result = gcnew CbcHeuristic();
+			result->Base = (::CbcHeuristic *)(derived);
+			result->TransferBase();
+			return result;
+		}
+
+		throw gcnew ArgumentException(L"Unknown CbcHeuristic", gcnew String(typeid(derived).name())); 
+	}
+
+	void CbcHeuristic::setModel(CbcModel ^ model)
+	{
+		Base->setModel(model->Base);
+	}
+
+	void CbcHeuristic::setHeuristicName(String ^ name)
+	{
+		char * charName = (char*)Marshal::StringToHGlobalAnsi(name).ToPointer();
+		Base->setHeuristicName(charName);
+		Marshal::FreeHGlobal((IntPtr)charName);
+	}
+}
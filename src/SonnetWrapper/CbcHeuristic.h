@@ -0,0 +1,196 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CbcHeuristic.hpp>
+#include <CbcHeuristicFPump.hpp>
+#include <CbcHeuristicRINS.hpp>
+#include <CbcHeuristicDiveCoefficient.hpp>
+#include <CbcHeuristicLocal.hpp>
+
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	ref class CbcModel;
+
+	/// <summary>
+	/// The base class of the primal heuristics of Cbc. Add heuristics to a model via CbcModel::addHeuristic, which stores a copy.
+	/// The frequency of a heuristic is set by setWhen and setNumberNodes, and in the deeper part of the tree by
+	/// setShallowDepth, setHowOftenShallow and setMinDistanceToRun.
+	/// </summary>
+	public ref class CbcHeuristic : WrapperAbstractBase<::CbcHeuristic>
+	{
+	public:
+		static CbcHeuristic ^ CreateDerived(::CbcHeuristic *derived);
+
+		/// Set the model, and do the setup of the heuristic for that model (done by CbcModel::addHeuristic)
+		void setModel(CbcModel ^ model);
+
+		/** Set when to run the heuristic:
+			0 - off
+			1 - at the root node only
+			2 - at the root node, and when a solution is found (unless switched off by the number of nodes)
+			>=10, see CbcHeuristic
+		*/
+		void setWhen(int value) { Base->setWhen(value); }
+		/// Get when to run the heuristic
+		int when() { return Base->when(); }
+
+		/// Set how often to run the heuristic, in number of nodes (code can change)
+		void setNumberNodes(int value) { Base->setNumberNodes(value); }
+		/// Get how often to run the heuristic, in number of nodes
+		int numberNodes() { return Base->numberNodes(); }
+
+		/// Set the upto depth at which the heuristic is run (with howOftenShallow)
+		void setShallowDepth(int value) { Base->setShallowDepth(value); }
+		/// Set how often to run the heuristic up to the shallow depth
+		void setHowOftenShallow(int value) { Base->setHowOftenShallow(value); }
+		/// Set the minimum distance (in depth) between two runs of the heuristic, below the shallow depth
+		void setMinDistanceToRun(int value) { Base->setMinDistanceToRun(value); }
+
+		/// Set the fraction of the problem that must be fixed for a sub-B&B heuristic to run (default 1.0)
+		void setFractionSmall(double value) { Base->setFractionSmall(value); }
+		/// Get the fraction of the problem that must be fixed for a sub-B&B heuristic to run
+		double fractionSmall() { return Base->fractionSmall(); }
+
+		/// Set the seed of the random number generator
+		void setSeed(int value) { Base->setSeed(value); }
+
+		/// Set the name of the heuristic
+		void setHeuristicName(String ^ name);
+		/// Get the name of the heuristic
+		String ^ heuristicName() { return gcnew String(Base->heuristicName()); }
+
+		/// Get the number of solutions found by this heuristic
+		int numberSolutionsFound() { return Base->numberSolutionsFound(); }
+	};
+
+	template<class T>
+	public ref class CbcHeuristicGeneric : CbcHeuristic
+	{
+	protected:
+		CbcHeuristicGeneric()
+		{
+			Base = new T();
+		}
+
+		CbcHeuristicGeneric(CbcModel ^ model)
+		{
+			Base = new T();
+			setModel(model);
+		}
+
+	protected:
+		property T * Base 
+		{
+			T * get()
+			{ 
+				return dynamic_cast<T*>(CbcHeuristic::Base); 
+			} 
+		}
+	};
+
+	/// <summary>
+	/// Rounding heuristic: rounds the solution of the LP relaxation.
+	/// </summary>
+	public ref class CbcRounding : CbcHeuristicGeneric<::CbcRounding>
+	{
+	public:
+		CbcRounding() { }
+		CbcRounding(CbcModel ^ model) : CbcHeuristicGeneric(model) { }
+	};
+
+	/// <summary>
+	/// Feasibility pump: alternates between rounding and projecting onto the LP relaxation.
+	/// </summary>
+	public ref class CbcHeuristicFPump : CbcHeuristicGeneric<::CbcHeuristicFPump>
+	{
+	public:
+		CbcHeuristicFPump() { }
+		CbcHeuristicFPump(CbcModel ^ model) : CbcHeuristicGeneric(model) { }
+
+		/// Set the maximum number of passes (default 100)
+		void setMaximumPasses(int value) { Base->setMaximumPasses(value); }
+		/// Get the maximum number of passes
+		int maximumPasses() { return Base->maximumPasses(); }
+		/// Set the maximum number of retries if a solution is found (default 1)
+		void setMaximumRetries(int value) { Base->setMaximumRetries(value); }
+		/// Get the maximum number of retries
+		int maximumRetries() { return Base->maximumRetries(); }
+		/// Set the maximum time in seconds for the feasibility pump
+		void setMaximumTime(double value) { Base->setMaximumTime(value); }
+		/// Get the maximum time in seconds
+		double maximumTime() { return Base->maximumTime(); }
+		/// Set the cutoff (as minimization)
+		void setCutoff(double value) { Base->setCutoff(value); }
+		/// Get the cutoff
+		double cutoff() { return Base->cutoff(); }
+		/// Set the absolute increment of the cutoff on a retry
+		void setAbsoluteIncrement(double value) { Base->setAbsoluteIncrement(value); }
+		/// Set the relative increment of the cutoff on a retry
+		void setRelativeIncrement(double value) { Base->setRelativeIncrement(value); }
+		/// Set the weight of the objective in the first pass (default 0.0, pure feasibility)
+		void setInitialWeight(double value) { Base->setInitialWeight(value); }
+		/// Set the factor by which the weight of the objective is multiplied each pass
+		void setWeightFactor(double value) { Base->setWeightFactor(value); }
+		/// Set the accumulation: 0 none, 1 fix variables that stayed at bound, 2 and 4 use the cutoff, see CbcHeuristicFPump
+		void setAccumulate(int value) { Base->setAccumulate(value); }
+		/// Get the accumulation
+		int accumulate() { return Base->accumulate(); }
+		/// Set whether to fix on reduced costs
+		void setFixOnReducedCosts(int value) { Base->setFixOnReducedCosts(value); }
+	};
+
+	/// <summary>
+	/// Relaxation induced neighborhood search: a sub-B&B with the variables fixed where the incumbent and the LP relaxation agree.
+	/// </summary>
+	public ref class CbcHeuristicRINS : CbcHeuristicGeneric<::CbcHeuristicRINS>
+	{
+	public:
+		CbcHeuristicRINS() { }
+		CbcHeuristicRINS(CbcModel ^ model) : CbcHeuristicGeneric(model) { }
+
+		/// Set how often to run the heuristic, in number of nodes
+		void setHowOften(int value) { Base->setHowOften(value); }
+	};
+
+	/// <summary>
+	/// Diving heuristic that rounds the variable with the smallest number of locks first.
+	/// </summary>
+	public ref class CbcHeuristicDiveCoefficient : CbcHeuristicGeneric<::CbcHeuristicDiveCoefficient>
+	{
+	public:
+		CbcHeuristicDiveCoefficient() { }
+		CbcHeuristicDiveCoefficient(CbcModel ^ model) : CbcHeuristicGeneric(model) { }
+
+		/// Set the percentage of integer variables to fix at their bounds
+		void setPercentageToFix(double value) { Base->setPercentageToFix(value); }
+		/// Set the maximum number of dives
+		void setMaxIterations(int value) { Base->setMaxIterations(value); }
+		/// Set the maximum number of simplex iterations
+		void setMaxSimplexIterations(int value) { Base->setMaxSimplexIterations(value); }
+		/// Set the maximum number of simplex iterations at the root node
+		void setMaxSimplexIterationsAtRoot(int value) { Base->setMaxSimplexIterationsAtRoot(value); }
+		/// Set the maximum time in seconds
+		void setMaxTime(double value) { Base->setMaxTime(value); }
+	};
+
+	/// <summary>
+	/// Local search: a sub-B&B in the neighborhood of the incumbent.
+	/// </summary>
+	public ref class CbcHeuristicLocal : CbcHeuristicGeneric<::CbcHeuristicLocal>
+	{
+	public:
+		CbcHeuristicLocal() { }
+		CbcHeuristicLocal(CbcModel ^ model) : CbcHeuristicGeneric(model) { }
+
+		/// Set the type of search: 0 fix integers at the incumbent, 1 also fix continuous, 2 use the incumbent as hint
+		void setSearchType(int value) { Base->setSearchType(value); }
+	};
+}
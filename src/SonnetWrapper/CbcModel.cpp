@@ -2,4 +2,401 @@
 // All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
-#include "CbcModel.h"
\ No newline at end of file
+#include <vector>
+#include <OsiRowCut.hpp>
+#include <OsiCuts.hpp>
+#include <CglStored.hpp>
+
+#include "CbcModel.h"
+
+namespace COIN
+{
+	bool CbcModel::branchAndBound(CglPreProcess^ process, int makeEquality, int numberPasses, int tuning, int doStatistics)
+	{
+		try
+		{
+			::CbcModel* model = Base;
+			::OsiSolverInterface* original = model->solver();
+			CglCutGeneratorProxy::startSolve(*model);
+			if (!original->isProvenOptimal()) original->initialSolve();
+
+			::OsiSolverInterface* processed = nullptr;
+			if (!original->isProvenPrimalInfeasible())
+			{
+				processed = process->Base->preProcessNonDefault(*original, makeEquality, numberPasses, tuning);
+			}
+
+			if (!processed)
+			{
+				// finished, and infeasible
+				model->setProblemStatus(0);
+				model->setSecondaryStatus(1);
+				return false;
+			}
+
+			// The preprocessed solver is owned by the CglPreProcess, so give a clone to the copy of this model.
+			// As CbcMain, the objects of the copy are created for the preprocessed columns, since the copied objects refer to the original columns
+			::CbcModel babModel(*model);
+			::OsiSolverInterface* solver = processed->clone();
+			babModel.assignSolver(solver);
+			babModel.deleteObjects(true);
+			babModel.branchAndBound(doStatistics);
+
+			// As CbcMain, move the status, the counts of nodes and iterations, and the best possible objective into this model
+			model->moveInfo(babModel);
+			if (babModel.bestSolution())
+			{
+				// Put the solution back into the original solver, and make it the best solution of this model
+				::OsiSolverInterface* babSolver = babModel.solver();
+				babSolver->setColSolution(babModel.bestSolution());
+				process->Base->postProcess(*babSolver);
+				model->setBestSolution(original->getColSolution(), original->getNumCols(), babModel.getMinimizationObjValue());
+			}
+
+			model->setProblemStatus(babModel.status());
+			model->setSecondaryStatus(babModel.secondaryStatus());
+			return true;
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	void CbcModel::setBestSolution(array<double> ^ solution, double objectiveValue)
+	{
+		if (solution == nullptr || solution->Length != Base->getNumCols()) throw gcnew ArgumentException("The solution should have a value per column.", "solution");
+		if (solution->Length == 0) return;
+
+		pin_ptr<double> values = &solution[0];
+		try
+		{
+			Base->setBestSolution(values, solution->Length, objectiveValue);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	bool CbcModel::setMIPStart(array<double> ^ solution, double tolerance, bool cutoffOnly)
+	{
+		::OsiSolverInterface* solver = Base->solver();
+		int n = solver->getNumCols();
+		if (solution == nullptr || solution->Length != n) throw gcnew ArgumentException("The solution should have a value per column.", "solution");
+		if (n == 0) return false;
+
+		pin_ptr<double> pinnedValues = &solution[0];
+		const double* values = pinnedValues;
+		try
+		{
+			const double* colLower = solver->getColLower();
+			const double* colUpper = solver->getColUpper();
+			for (int j = 0; j < n; j++)
+			{
+				double value = values[j];
+				if (value < colLower[j] - tolerance || value > colUpper[j] + tolerance) return false;
+				if (solver->isInteger(j) && fabs(value - floor(value + 0.5)) > tolerance) return false;
+			}
+
+			int m = solver->getNumRows();
+			if (m > 0)
+			{
+				std::vector<double> activity(m);
+				solver->getMatrixByCol()->times(values, &activity[0]);
+
+				const double* rowLower = solver->getRowLower();
+				const double* rowUpper = solver->getRowUpper();
+				for (int i = 0; i < m; i++)
+				{
+					if (activity[i] < rowLower[i] - tolerance || activity[i] > rowUpper[i] + tolerance) return false;
+				}
+			}
+
+			// the objective value as minimization, as Cbc
+			const double* objective = solver->getObjCoefficients();
+			double objectiveValue = 0.0;
+			for (int j = 0; j < n; j++) objectiveValue += objective[j] * values[j];
+			double offset = 0.0;
+			solver->getDblParam(OsiObjOffset, offset);
+			objectiveValue = (objectiveValue - offset) * solver->getObjSense();
+
+			// Without the incumbent, a solution as good as the given one must still be found. 
+			// Cbc prunes the nodes that are not better than the cutoff, so a cutoff at the objective value of an optimal start
+			// would prune the optimum, and the solve would end without a solution.
+			if (!cutoffOnly) Base->setBestSolution(values, n, objectiveValue);
+			else objectiveValue += 1.0e-6 * (1.0 + fabs(objectiveValue));
+			if (objectiveValue < Base->getCutoff()) Base->setCutoff(objectiveValue);
+			return true;
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	int CbcModel::fixOnReducedCosts(double tolerance)
+	{
+		::OsiSolverInterface* solver = Base->solver();
+		double cutoff = Base->getCutoff();
+		if (cutoff >= 1.0e50) return 0;
+
+		try
+		{
+			// the root LP, from the current basis, since the reduced costs of an earlier solve may be out of date
+			solver->resolve();
+			if (!solver->isProvenOptimal()) return 0;
+
+			// as minimization, as the cutoff
+			double direction = solver->getObjSense();
+			double gap = cutoff - solver->getObjValue() * direction;
+			if (gap < 0.0) return 0;
+
+			int n = solver->getNumCols();
+			const double* colLower = solver->getColLower();
+			const double* colUpper = solver->getColUpper();
+			const double* x = solver->getColSolution();
+			const double* reducedCost = solver->getReducedCost();
+			double primalTolerance = 1.0e-7;
+			solver->getDblParam(OsiPrimalTolerance, primalTolerance);
+
+			std::vector<int> indices;
+			std::vector<double> bounds;
+			for (int j = 0; j < n; j++)
+			{
+				if (!solver->isInteger(j) || colLower[j] == colUpper[j]) continue;
+
+				double dj = reducedCost[j] * direction;
+				if (dj > gap + tolerance && x[j] <= colLower[j] + primalTolerance)
+				{
+					indices.push_back(j);
+					bounds.push_back(colLower[j]);
+					bounds.push_back(colLower[j]);
+				}
+				else if (-dj > gap + tolerance && x[j] >= colUpper[j] - primalTolerance)
+				{
+					indices.push_back(j);
+					bounds.push_back(colUpper[j]);
+					bounds.push_back(colUpper[j]);
+				}
+			}
+
+			int numberFixed = (int)indices.size();
+			if (numberFixed > 0) solver->setColSetBounds(&indices[0], &indices[0] + numberFixed, &bounds[0]);
+			return numberFixed;
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	void CbcModel::passInPriorities(array<int> ^ priorities, bool ifNotSimpleIntegers)
+	{
+		if (priorities == nullptr || priorities->Length != Base->numberIntegers()) throw gcnew ArgumentException("The priorities should have a value per integer variable.", "priorities");
+		if (priorities->Length == 0) return;
+
+		pin_ptr<int> values = &priorities[0];
+		try
+		{
+			Base->passInPriorities(values, ifNotSimpleIntegers);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	void CbcModel::addObjects(array<CbcObject ^> ^ objects)
+	{
+		if (objects == nullptr) throw gcnew ArgumentNullException("objects");
+		int n = objects->Length;
+		if (n == 0) return;
+
+		std::vector<::CbcObject *> natives(n);
+		for (int i = 0; i < n; i++) natives[i] = objects[i]->Base;
+
+		try
+		{
+			// the model stores clones
+			Base->addObjects(n, &natives[0]);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	CbcObject ^ CbcModel::object(int i)
+	{
+		if (i < 0 || i >= Base->numberObjects()) throw gcnew ArgumentOutOfRangeException("i");
+
+		::CbcObject * derived = dynamic_cast<::CbcObject *>(Base->modifiableObject(i));
+		if (derived == nullptr) throw gcnew NotSupportedException("The object is not a CbcObject.");
+		return CbcObject::CreateDerived(derived);
+	}
+
+	CbcCutPool ^ CbcModel::getCuts(int firstRow)
+	{
+		::OsiSolverInterface * solver = Base->solver();
+		if (firstRow < 0 || firstRow > solver->getNumRows()) throw gcnew ArgumentOutOfRangeException("firstRow");
+
+		// the rows added to the continuous model, and then the cuts of the pool
+		CbcCutBlock block;
+		block.appendRows(solver, firstRow);
+		block.appendCuts(Base->globalCuts());
+		return CbcCutPool::Create(block, solver->getColSolution());
+	}
+
+	CbcCutPool ^ CbcModel::branchAndBoundGetCuts(int doStatistics)
+	{
+		CbcRootCuts rootCuts;
+		CbcRootCutsEventHandler handler(&rootCuts, Base->getEventHandler());
+		Base->passInEventHandler(&handler);
+
+		try
+		{
+			branchAndBound(doStatistics);
+		}
+		finally
+		{
+			// install the handler of the model before again
+			removeEventHandler();
+		}
+
+		CbcCutBlock & block = rootCuts.cuts;
+		block.appendCuts(Base->globalCuts());
+		const double * solution = (Base->bestSolution() != nullptr) ? Base->bestSolution() : Base->solver()->getColSolution();
+		return CbcCutPool::Create(block, solution);
+	}
+
+	int CbcModel::addCuts(CbcCutPool ^ cuts, bool purgeNotTight, double tolerance)
+	{
+		if (cuts == nullptr) throw gcnew ArgumentNullException("cuts");
+
+		int numberColumns = Base->solver()->getNumCols();
+		array<int> ^ cutStarts = cuts->getStarts();
+		array<int> ^ cutColumns = cuts->getColumns();
+		array<double> ^ cutElements = cuts->getElements();
+		array<double> ^ cutLower = cuts->getRowLower();
+		array<double> ^ cutUpper = cuts->getRowUpper();
+
+		::OsiCuts pool;
+		std::vector<int> columns;
+		std::vector<double> elements;
+		for (int i = 0, m = cuts->numberCuts(); i < m; i++)
+		{
+			if (purgeNotTight && !cuts->isTight(i, tolerance)) continue;
+
+			columns.clear();
+			elements.clear();
+			for (int k = cutStarts[i]; k < cutStarts[i + 1]; k++)
+			{
+				int j = cutColumns[k];
+				if (j < 0 || j >= numberColumns) throw gcnew ArgumentException("The cuts have a column that is not in the model.", "cuts");
+				columns.push_back(j);
+				elements.push_back(cutElements[k]);
+			}
+
+			::OsiRowCut cut;
+			cut.setRow((int)columns.size(), columns.empty() ? nullptr : &columns[0], elements.empty() ? nullptr : &elements[0], false);
+			cut.setLb(cutLower[i]);
+			cut.setUb(cutUpper[i]);
+			cut.setGloballyValid(true);
+			pool.insert(cut);
+		}
+
+		int numberCuts = pool.sizeRowCuts();
+		if (numberCuts == 0) return 0;
+
+		try
+		{
+			// the model stores a copy of the generator
+			::CglStored stored(numberColumns);
+			stored.addCut(pool);
+			Base->addCutGenerator(&stored, 1, "Stored");
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+
+		return numberCuts;
+	}
+
+	int CbcModel::getPseudoCosts(array<double> ^ downCosts, array<double> ^ upCosts, array<int> ^ numberTimesDown, array<int> ^ numberTimesUp)
+	{
+		int numberColumns = Base->getNumCols();
+		if (downCosts == nullptr || downCosts->Length != numberColumns) throw gcnew ArgumentException("The down costs should have a value per column.", "downCosts");
+		if (upCosts == nullptr || upCosts->Length != numberColumns) throw gcnew ArgumentException("The up costs should have a value per column.", "upCosts");
+		if (numberTimesDown == nullptr || numberTimesDown->Length != numberColumns) throw gcnew ArgumentException("The number of times down should have a value per column.", "numberTimesDown");
+		if (numberTimesUp == nullptr || numberTimesUp->Length != numberColumns) throw gcnew ArgumentException("The number of times up should have a value per column.", "numberTimesUp");
+
+		Array::Clear(downCosts, 0, numberColumns);
+		Array::Clear(upCosts, 0, numberColumns);
+		Array::Clear(numberTimesDown, 0, numberColumns);
+		Array::Clear(numberTimesUp, 0, numberColumns);
+
+		int count = 0;
+		for (int i = 0, n = Base->numberObjects(); i < n; i++)
+		{
+			const ::CbcSimpleIntegerDynamicPseudoCost * dynamic = dynamic_cast<const ::CbcSimpleIntegerDynamicPseudoCost *>(Base->object(i));
+			if (dynamic == nullptr) continue;
+
+			int j = dynamic->columnNumber();
+			downCosts[j] = dynamic->downDynamicPseudoCost();
+			upCosts[j] = dynamic->upDynamicPseudoCost();
+			numberTimesDown[j] = dynamic->numberTimesDown();
+			numberTimesUp[j] = dynamic->numberTimesUp();
+			count++;
+		}
+
+		return count;
+	}
+
+	int CbcModel::setPseudoCosts(array<double> ^ downCosts, array<double> ^ upCosts, array<int> ^ numberTimesDown, array<int> ^ numberTimesUp)
+	{
+		int numberColumns = Base->getNumCols();
+		if (downCosts == nullptr || downCosts->Length != numberColumns) throw gcnew ArgumentException("The down costs should have a value per column.", "downCosts");
+		if (upCosts == nullptr || upCosts->Length != numberColumns) throw gcnew ArgumentException("The up costs should have a value per column.", "upCosts");
+		if (numberTimesDown == nullptr || numberTimesDown->Length != numberColumns) throw gcnew ArgumentException("The number of times down should have a value per column.", "numberTimesDown");
+		if (numberTimesUp == nullptr || numberTimesUp->Length != numberColumns) throw gcnew ArgumentException("The number of times up should have a value per column.", "numberTimesUp");
+
+		try
+		{
+			Base->findIntegers(false);
+			Base->convertToDynamic();
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+
+		int count = 0;
+		for (int i = 0, n = Base->numberObjects(); i < n; i++)
+		{
+			::CbcSimpleIntegerDynamicPseudoCost * dynamic = dynamic_cast<::CbcSimpleIntegerDynamicPseudoCost *>(Base->modifiableObject(i));
+			if (dynamic == nullptr) continue;
+
+			int j = dynamic->columnNumber();
+			if (numberTimesDown[j] <= 0 && numberTimesUp[j] <= 0) continue;
+
+			// the pseudocosts are the averages of the sums of the costs
+			if (numberTimesDown[j] > 0)
+			{
+				dynamic->setDownDynamicPseudoCost(downCosts[j]);
+				dynamic->setSumDownCost(downCosts[j] * numberTimesDown[j]);
+				dynamic->setNumberTimesDown(numberTimesDown[j]);
+			}
+			if (numberTimesUp[j] > 0)
+			{
+				dynamic->setUpDynamicPseudoCost(upCosts[j]);
+				dynamic->setSumUpCost(upCosts[j] * numberTimesUp[j]);
+				dynamic->setNumberTimesUp(numberTimesUp[j]);
+			}
+			count++;
+		}
+
+		return count;
+	}
+}
\ No newline at end of file
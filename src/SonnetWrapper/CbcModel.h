@@ -7,7 +7,14 @@
 #include <CbcModel.hpp>
 
 #include "CbcStrategy.h"
+#include "CbcHeuristic.h"
+#include "CbcObject.h"
+#include "CbcEventHandler.h"
+#include "CbcCompare.h"
+#include "CbcCutPool.h"
 #include "CglCutGenerator.h"
+#include "CglManagedCutGenerator.h"
+#include "CglPreProcess.h"
 #include "CbcCutGenerator.h"
 #include "OsiSolverInterface.h"
 #include "Helpers.h"
@@ -46,6 +53,7 @@ namespace COIN
   */
 		void branchAndBound(int doStatistics)
 		{
+			CglCutGeneratorProxy::startSolve(*Base);
 			Base->branchAndBound(doStatistics);
 		}
 
@@ -54,6 +62,38 @@ namespace COIN
 			branchAndBound(0);
 		}
 
+		/// <summary>
+		/// Invoke the branch and cut algorithm on the model preprocessed by the given CglPreProcess (with its cut generators,
+		/// e.g., CglProbing), see CglPreProcess::preProcessNonDefault for makeEquality, numberPasses and tuning.
+		/// The branch and cut is done on a copy of this model (incl. its settings, cut generators and heuristics) with the
+		/// preprocessed solver, and the best solution is postprocessed into the solver of this model.
+		/// The branching objects of the copy are created for the preprocessed columns, so priorities and SOS of this model are not used.
+		/// Afterwards, the status, best solution, best possible objective, and node and iteration counts of this model are set
+		/// as if branch and bound had been done on this model.
+		/// Returns false if the preprocessing found the model to be infeasible, and true otherwise.
+		/// </summary>
+		bool branchAndBound(CglPreProcess^ process, int makeEquality, int numberPasses, int tuning, int doStatistics);
+
+		/// <summary>
+		/// Set the best solution (incumbent) and its objective value (as minimization), without any checks.
+		/// </summary>
+		void setBestSolution(array<double> ^ solution, double objectiveValue);
+
+		/// <summary>
+		/// Check the given solution (a value per column) for feasibility: within the column bounds, integral for the integer columns,
+		/// and within the row bounds, all with the given tolerance. If feasible, make it the best solution (incumbent) of this model
+		/// for the branch and bound, and lower the cutoff to its objective value. If cutoffOnly, only the cutoff is lowered, to 
+		/// just above its objective value so that a solution as good as the given one is still found.
+		/// Returns false if the solution is not feasible, and then the model is not changed.
+		/// Only for linear objectives.
+		/// </summary>
+		bool setMIPStart(array<double> ^ solution, double tolerance, bool cutoffOnly);
+
+		bool setMIPStart(array<double> ^ solution, double tolerance)
+		{
+			return setMIPStart(solution, tolerance, false);
+		}
+
 		OsiSolverInterface^ solver() {
 			return OsiSolverInterface::CreateDerived(Base->solver());
 		}
@@ -156,6 +196,239 @@ namespace COIN
 		}	    
 		#pragma endregion
 
+		#pragma region Cuts
+		/// Get the cuts of the model: the rows of the solver from firstRow on, and the cuts of the global cut pool.
+		/// The branch and bound removes its cuts from the solver during the tree search, so after a branch and bound 
+		/// use branchAndBoundGetCuts instead. The activities are at the current solution of the solver.
+		CbcCutPool ^ getCuts(int firstRow);
+
+		/// Invoke the branch and cut algorithm as branchAndBound(doStatistics), and return the globally valid cuts it generated: 
+		/// the cuts at the end of the root (the rows added to the continuous model), and the cuts of the global cut pool at the end.
+		/// During the branch and bound, the current event handler remains in use, chained by a handler that records the root cuts.
+		/// The activities are at the best solution, or at the current solution of the solver if there is none.
+		CbcCutPool ^ branchAndBoundGetCuts(int doStatistics);
+
+		/// Add the given cuts as a cut pool of the model (a CglStored cut generator), for example before the branch and bound of 
+		/// the same or a tightened model: at each node, the cuts of the pool that are violated are added, as globally valid cuts. 
+		/// If purgeNotTight, only the cuts that were tight (within the tolerance) at the solution of extraction are added to the pool. 
+		/// Returns the number of cuts added to the pool.
+		int addCuts(CbcCutPool ^ cuts, bool purgeNotTight, double tolerance);
+		#pragma endregion
+
+		#pragma region Heuristics
+		/// Add one heuristic. The model stores a copy, so changes to the given heuristic after adding have no effect.
+		/// Use heuristic(i) to change the settings of the added copy.
+		void addHeuristic(CbcHeuristic ^ generator, String ^ name, int before)
+		{
+			char * charName = nullptr;
+			if (name != nullptr) charName = (char*)Marshal::StringToHGlobalAnsi(name).ToPointer();
+
+			try
+			{
+				int where = Base->numberHeuristics();
+				if (before >= 0 && before < where) where = before;
+
+				Base->addHeuristic(generator->Base, charName, before);
+				// default constructed heuristics have no model yet
+				Base->heuristic(where)->setModel(Base);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+			finally
+			{
+				if (name != nullptr) Marshal::FreeHGlobal((IntPtr)charName);
+			}
+		}
+
+		void addHeuristic(CbcHeuristic ^ generator, String ^ name)
+		{
+			addHeuristic(generator, name, -1);
+		}
+
+		void addHeuristic(CbcHeuristic ^ generator)
+		{
+			addHeuristic(generator, nullptr, -1);
+		}
+
+		/// Get the number of heuristics
+		int numberHeuristics()
+		{
+			return Base->numberHeuristics();
+		}
+
+		/// Get the specified heuristic. The result is owned by the model.
+		CbcHeuristic ^ heuristic(int i)
+		{
+			if (i < 0 || i >= Base->numberHeuristics()) throw gcnew ArgumentOutOfRangeException("i");
+			return CbcHeuristic::CreateDerived(Base->heuristic(i));
+		}
+
+		/// Get all heuristics. The results are owned by the model.
+		array<CbcHeuristic ^> ^ heuristics()
+		{
+			int n = Base->numberHeuristics();
+			array<CbcHeuristic ^> ^ result = gcnew array<CbcHeuristic ^>(n);
+			for (int i = 0; i < n; i++) result[i] = CbcHeuristic::CreateDerived(Base->heuristic(i));
+			return result;
+		}
+		#pragma endregion
+
+		#pragma region Objects
+		/// Identify the integer variables and create a simple integer object for each.
+		/// If startAgain, the existing simple integer objects are replaced, but other objects (SOS etc.) are kept.
+		void findIntegers(bool startAgain)
+		{
+			Base->findIntegers(startAgain);
+		}
+
+		/// Get the number of integer variables (after findIntegers)
+		int numberIntegers()
+		{
+			return Base->numberIntegers();
+		}
+
+		/// Get the columns of the integer variables (after findIntegers)
+		array<int> ^ integerVariable()
+		{
+			int n = Base->numberIntegers();
+			array<int> ^ result = gcnew array<int>(n);
+			if (n > 0) Marshal::Copy(IntPtr((void *)Base->integerVariable()), result, 0, n);
+			return result;
+		}
+
+		/// Delete all objects, and if findIntegers, create the simple integer objects again
+		void deleteObjects(bool findIntegers)
+		{
+			Base->deleteObjects(findIntegers);
+		}
+
+		/// Pass in the branching priorities, one per integer variable in the order of integerVariable (lower values are branched on first).
+		/// If ifNotSimpleIntegers, the objects that are not simple integers are created as well.
+		void passInPriorities(array<int> ^ priorities, bool ifNotSimpleIntegers);
+
+		/// Add copies of the given objects (SOS etc.) to the model
+		void addObjects(array<CbcObject ^> ^ objects);
+
+		/// Get the number of objects
+		int numberObjects()
+		{
+			return Base->numberObjects();
+		}
+
+		/// Get the specified object. The result is owned by the model.
+		CbcObject ^ object(int i);
+
+		/// Set the number of times a variable is branched on before its pseudocosts are trusted, instead of strong branching.
+		/// If positive, the branch and bound uses dynamic pseudocost objects (CbcSimpleIntegerDynamicPseudoCost).
+		void setNumberBeforeTrust(int number)
+		{
+			Base->setNumberBeforeTrust(number);
+		}
+
+		/// Get the number of times a variable is branched on before its pseudocosts are trusted
+		int numberBeforeTrust()
+		{
+			return Base->numberBeforeTrust();
+		}
+
+		/// Replace the simple integer objects by dynamic pseudocost objects, as the branch and bound does if numberBeforeTrust > 0.
+		/// Existing dynamic pseudocost objects are kept.
+		void convertToDynamic()
+		{
+			Base->convertToDynamic();
+		}
+
+		/// Get the pseudocosts of the dynamic pseudocost objects, one value per column (zero for other columns).
+		/// Returns the number of dynamic pseudocost objects.
+		int getPseudoCosts(array<double> ^ downCosts, array<double> ^ upCosts, array<int> ^ numberTimesDown, array<int> ^ numberTimesUp);
+
+		/// Set the pseudocosts of the dynamic pseudocost objects, one value per column, for example learned by a previous solve.
+		/// The simple integer objects are converted to dynamic pseudocost objects first. Only the directions with a positive 
+		/// number of times are set, so that a variable branched on at least numberBeforeTrust times is trusted at once.
+		/// Returns the number of objects changed.
+		int setPseudoCosts(array<double> ^ downCosts, array<double> ^ upCosts, array<int> ^ numberTimesDown, array<int> ^ numberTimesUp);
+		#pragma endregion
+
+		/// Set the event handler. The model stores a copy, that shares the recorded events with the given handler.
+		void passInEventHandler(CbcEventHandler ^ eventHandler)
+		{
+			if (eventHandler != nullptr) Base->passInEventHandler(eventHandler->Base);
+			else Base->passInEventHandler(nullptr);
+		}
+
+		/// Set the event handler. The model stores a copy, that shares the recorded events with the given handler.
+		/// If chain, the current event handler of the model remains in use, chained by the new handler. 
+		void passInEventHandler(CbcEventHandler ^ eventHandler, bool chain)
+		{
+			if (!chain || eventHandler == nullptr) 
+			{
+				passInEventHandler(eventHandler);
+				return;
+			}
+
+			CbcChainedEventHandler * handler = dynamic_cast<CbcChainedEventHandler *>(eventHandler->Base->clone());
+			handler->setChainedHandler(Base->getEventHandler());
+			Base->passInEventHandler(handler);
+			delete handler;
+		}
+
+		/// Remove the current event handler. If it chains another handler, then that handler is installed again.
+		void removeEventHandler()
+		{
+			const CbcChainedEventHandler * current = dynamic_cast<CbcChainedEventHandler *>(Base->getEventHandler());
+			::CbcEventHandler * chained = current != nullptr && current->chainedHandler() != nullptr ? current->chainedHandler()->clone() : nullptr;
+
+			Base->passInEventHandler(chained);
+			delete chained;
+		}
+
+		/// Install an event handler that stops the branch and bound at the next event once the given flag is raised.
+		/// The current event handler remains in use, chained by the new handler.
+		/// If null, the stop flag handler is removed, and the chained handler is installed again.
+		void passInStopFlag(CoinStopFlag ^ stopFlag)
+		{
+			const CbcStopEventHandler * current = dynamic_cast<CbcStopEventHandler *>(Base->getEventHandler());
+
+			if (stopFlag != nullptr)
+			{
+				// dont chain stop flags
+				CbcStopEventHandler handler(stopFlag->Flag, current != nullptr ? current->chainedHandler() : Base->getEventHandler());
+				Base->passInEventHandler(&handler);
+			}
+			else if (current != nullptr)
+			{
+				removeEventHandler();
+			}
+		}
+
+		/// Tell the branch and bound to stop at its next check, as if an event handler returned stop. 
+		/// The branch and bound resets this at its start.
+		void sayEventHappened()
+		{
+			Base->sayEventHappened();
+		}
+
+		/// Get the node comparison, which selects the next node of the branch and bound tree. 
+		/// The comparison is owned by the model.
+		CbcCompareBase ^ nodeComparison()
+		{
+			return CbcCompareBase::CreateDerived(Base->nodeComparison());
+		}
+
+		/// Set the node comparison. The model stores a copy, so change the settings of the comparison before.
+		/// If null, the default comparison (CbcCompareDefault) is installed again.
+		void setNodeComparison(CbcCompareBase ^ compare)
+		{
+			if (compare != nullptr) Base->setNodeComparison(compare->Base);
+			else 
+			{
+				::CbcCompareDefault compareDefault;
+				Base->setNodeComparison(compareDefault);
+			}
+		}
+
 		CbcStrategy ^ strategy()
 		{
 			return CbcStrategy::CreateDerived(Base->strategy());
@@ -237,12 +510,167 @@ namespace COIN
 			return Base->bestSolution();
 		}
 
+		/// Get the number of nodes evaluated in the branch and bound
+		int getNodeCount()
+		{
+			return Base->getNodeCount();
+		}
+
+		/// Get the total number of LP iterations in the branch and bound
+		int getIterationCount()
+		{
+			return Base->getIterationCount();
+		}
+
 		/// Final status of problem - 0 finished, 1 stopped, 2 difficulties
 		int status()
 		{ 
 			return Base->status();
 		}
 
+		/** Secondary status of problem
+			-1 unset (status_ will also be -1)
+			0 search completed with solution
+			1 linear relaxation not feasible (or worse than cutoff)
+			2 stopped on gap
+			3 stopped on nodes
+			4 stopped on time
+			5 stopped on user event
+			6 stopped on solutions
+			7 linear relaxation unbounded
+			8 stopped on iteration limit
+		*/
+		int secondaryStatus()
+		{
+			return Base->secondaryStatus();
+		}
+
+		#pragma region Limits
+		/// Set the maximum number of seconds for the branch and bound. Returns true if the value is accepted.
+		bool setMaximumSeconds(double value)
+		{
+			return Base->setMaximumSeconds(value);
+		}
+		/// Get the maximum number of seconds for the branch and bound
+		double getMaximumSeconds()
+		{
+			return Base->getMaximumSeconds();
+		}
+		/// Get the number of seconds since the start of the branch and bound
+		double getCurrentSeconds()
+		{
+			return Base->getCurrentSeconds();
+		}
+
+		/// Set the maximum number of nodes to evaluate. Returns true if the value is accepted.
+		bool setMaximumNodes(int value)
+		{
+			return Base->setMaximumNodes(value);
+		}
+		/// Get the maximum number of nodes to evaluate
+		int getMaximumNodes()
+		{
+			return Base->getMaximumNodes();
+		}
+
+		/// Set the maximum number of solutions. Returns true if the value is accepted.
+		bool setMaximumSolutions(int value)
+		{
+			return Base->setMaximumSolutions(value);
+		}
+		/// Get the maximum number of solutions
+		int getMaximumSolutions()
+		{
+			return Base->getMaximumSolutions();
+		}
+
+		/// Set the allowable gap between the best known solution and the best possible solution. 
+		/// The branch and bound stops once the gap is reached. Returns true if the value is accepted.
+		bool setAllowableGap(double value)
+		{
+			return Base->setAllowableGap(value);
+		}
+		/// Get the allowable gap
+		double getAllowableGap()
+		{
+			return Base->getAllowableGap();
+		}
+
+		/// Set the allowable fraction gap (relative to the best known solution) between the best known solution and the best possible solution.
+		/// The branch and bound stops once the gap is reached. Returns true if the value is accepted.
+		bool setAllowableFractionGap(double value)
+		{
+			return Base->setAllowableFractionGap(value);
+		}
+		/// Get the allowable fraction gap
+		double getAllowableFractionGap()
+		{
+			return Base->getAllowableFractionGap();
+		}
+
+		/// Set the cutoff bound on the objective function (as minimization). 
+		/// Only solutions better than the cutoff are searched for.
+		void setCutoff(double value)
+		{
+			Base->setCutoff(value);
+		}
+		/// Get the cutoff bound on the objective function (as minimization)
+		double getCutoff()
+		{
+			return Base->getCutoff();
+		}
+
+		/// Set the cutoff increment: after a solution is found, the cutoff is set to its objective value minus this increment.
+		/// For an objective with granularity, use an increment just below the granularity (see analyzeObjective).
+		void setCutoffIncrement(double value)
+		{
+			Base->setCutoffIncrement(value);
+		}
+		/// Get the cutoff increment
+		double getCutoffIncrement()
+		{
+			return Base->getCutoffIncrement();
+		}
+
+		/// Fix integer columns by their reduced costs, before the branch and bound, if a cutoff is known (for example from a MIP start).
+		/// The LP relaxation of the solver is (re)solved first. An integer column at its lower bound with a reduced cost larger than 
+		/// the gap between the cutoff and the LP objective value cannot increase in a better solution, and is fixed at its lower bound, 
+		/// and vice versa. The bounds are changed in bulk (setColSetBounds), and are not restored by this model. 
+		/// Returns the number of columns fixed, or 0 if there is no cutoff or the LP relaxation is not optimal.
+		int fixOnReducedCosts(double tolerance);
+
+		/// Analyze the objective function to find the minimum change of the objective value between integer solutions 
+		/// (for example, if only integer columns have costs, and these are multiples of a common value), and if found, 
+		/// set the cutoff increment just below it, unless the current increment is larger.
+		void analyzeObjective()
+		{
+			try
+			{
+				Base->analyzeObjective();
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		/// Returns true if the node limit was reached
+		bool isNodeLimitReached()
+		{
+			return Base->isNodeLimitReached();
+		}
+		/// Returns true if the time limit was reached
+		bool isSecondsLimitReached()
+		{
+			return Base->isSecondsLimitReached();
+		}
+		/// Returns true if the solution limit was reached
+		bool isSolutionLimitReached()
+		{
+			return Base->isSolutionLimitReached();
+		}
+		#pragma endregion
+
 		/// Get the number of cut generators
 		int numberCutGenerators() 
 		{
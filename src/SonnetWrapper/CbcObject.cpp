@@ -0,0 +1,103 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <CbcModel.hpp>
+
+#include "CbcObject.h"
+#include "CbcModel.h"
+
+namespace COIN
+{
+	CbcObject ^ CbcObject::CreateDerived(::CbcObject *derived)
+	{
+		if (dynamic_cast<::CbcSimpleIntegerDynamicPseudoCost *>(derived))
+		{
+			CbcObject ^ result = gcnew CbcSimpleIntegerDynamicPseudoCost();
+			result->Base = (::CbcSimpleIntegerDynamicPseudoCost *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcSimpleInteger *>(derived))
+		{
+			CbcObject ^ result = gcnew CbcSimpleInteger();
+			result->Base = (::CbcSimpleInteger *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CbcSOS *>(derived))
+		{
+			CbcObject ^ result = gcnew CbcSOS();
+			result->Base = (::CbcSOS *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else
+		{
+			CbcObject ^ result = gcnew CbcObject();
+			result->Base = (::CbcObject *)(derived);
+			result->TransferBase();
+			return result;
+		}
+
+		throw gcnew ArgumentException(L"Unknown CbcObject", gcnew String(typeid(derived).name())); 
+	}
+
+	CbcSimpleInteger::CbcSimpleInteger(CbcModel ^ model, int iColumn, double breakEven)
+	{
+		try
+		{
+			Base = new ::CbcSimpleInteger(model->Base, iColumn, breakEven);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	CbcSimpleInteger::CbcSimpleInteger(CbcModel ^ model, int iColumn)
+	{
+		try
+		{
+			Base = new ::CbcSimpleInteger(model->Base, iColumn);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	CbcSOS::CbcSOS(CbcModel ^ model, array<int> ^ which, array<double> ^ weights, int identifier, int type)
+	{
+		if (which == nullptr || which->Length == 0) throw gcnew ArgumentException("A set needs at least one member.", "which");
+		if (weights != nullptr && weights->Length != which->Length) throw gcnew ArgumentException("The number of weights should equal the number of members.", "weights");
+		if (type != 1 && type != 2) throw gcnew ArgumentOutOfRangeException("type");
+
+		pin_ptr<int> whichPtr = &which[0];
+		pin_ptr<double> weightsPtr = (weights != nullptr) ? &weights[0] : nullptr;
+		try
+		{
+			Base = new ::CbcSOS(model->Base, which->Length, whichPtr, weightsPtr, identifier, type);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	array<int> ^ CbcSOS::members()
+	{
+		int n = Derived->numberMembers();
+		array<int> ^ result = gcnew array<int>(n);
+		if (n > 0) Marshal::Copy(IntPtr((void *)Derived->members()), result, 0, n);
+		return result;
+	}
+
+	array<double> ^ CbcSOS::weights()
+	{
+		int n = Derived->numberMembers();
+		array<double> ^ result = gcnew array<double>(n);
+		if (n > 0) Marshal::Copy(IntPtr((void *)Derived->weights()), result, 0, n);
+		return result;
+	}
+}
@@ -0,0 +1,163 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CbcObject.hpp>
+#include <CbcSimpleInteger.hpp>
+#include <CbcSimpleIntegerDynamicPseudoCost.hpp>
+#include <CbcSOS.hpp>
+
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	ref class CbcModel;
+
+	/// <summary>
+	/// The base class of the branching objects of Cbc: simple integers, special ordered sets, etc.
+	/// Objects with a lower priority value are branched on first (the Cbc default priority is 1000).
+	/// Add objects to a model via CbcModel::addObjects, which stores copies.
+	/// </summary>
+	public ref class CbcObject : WrapperAbstractBase<::CbcObject>
+	{
+	public:
+		static CbcObject ^ CreateDerived(::CbcObject *derived);
+
+		/// Set the priority: objects with a lower value are branched on first
+		void setPriority(int value) { Base->setPriority(value); }
+		/// Get the priority
+		int priority() { return Base->priority(); }
+
+		/// Set the preferred way to branch: -1 down, +1 up, 0 no preference
+		void setPreferredWay(int value) { Base->setPreferredWay(value); }
+		/// Get the preferred way to branch
+		int preferredWay() { return Base->preferredWay(); }
+
+		/// Get the identifier
+		int id() { return Base->id(); }
+	};
+
+	/// <summary>
+	/// A simple integer variable, created for each integer column by CbcModel::findIntegers.
+	/// </summary>
+	public ref class CbcSimpleInteger : CbcObject
+	{
+	public:
+		/// Create a simple integer object for the given column, with the given break even (default 0.5):
+		/// at a value above break even, the up branch is taken first.
+		CbcSimpleInteger(CbcModel ^ model, int iColumn, double breakEven);
+		CbcSimpleInteger(CbcModel ^ model, int iColumn);
+
+		/// Get the column number
+		int columnNumber() { return Derived->columnNumber(); }
+
+		/// Set the break even
+		void setBreakEven(double value) { Derived->setBreakEven(value); }
+		/// Get the break even
+		double breakEven() { return Derived->breakEven(); }
+
+	internal:
+		CbcSimpleInteger() { }
+
+	protected:
+		property ::CbcSimpleInteger * Derived
+		{
+			::CbcSimpleInteger * get()
+			{
+				return dynamic_cast<::CbcSimpleInteger*>(Base);
+			}
+		}
+	};
+
+	/// <summary>
+	/// A simple integer variable with pseudocosts that are learned during the branch and bound: the average objective change 
+	/// per unit change of the variable when branching down or up. CbcModel::convertToDynamic creates these objects, and the 
+	/// branch and bound does so if numberBeforeTrust > 0. The pseudocosts of a variable are trusted once it has been 
+	/// branched on numberBeforeTrust times; before that, strong branching is used.
+	/// </summary>
+	public ref class CbcSimpleIntegerDynamicPseudoCost : CbcSimpleInteger
+	{
+	public:
+		/// Get the down pseudocost
+		double downDynamicPseudoCost() { return Derived->downDynamicPseudoCost(); }
+		/// Set the down pseudocost
+		void setDownDynamicPseudoCost(double value) { Derived->setDownDynamicPseudoCost(value); }
+		/// Get the up pseudocost
+		double upDynamicPseudoCost() { return Derived->upDynamicPseudoCost(); }
+		/// Set the up pseudocost
+		void setUpDynamicPseudoCost(double value) { Derived->setUpDynamicPseudoCost(value); }
+
+		/// Get the sum of the down costs, of which the down pseudocost is the average
+		double sumDownCost() { return Derived->sumDownCost(); }
+		/// Set the sum of the down costs
+		void setSumDownCost(double value) { Derived->setSumDownCost(value); }
+		/// Get the sum of the up costs, of which the up pseudocost is the average
+		double sumUpCost() { return Derived->sumUpCost(); }
+		/// Set the sum of the up costs
+		void setSumUpCost(double value) { Derived->setSumUpCost(value); }
+
+		/// Get the number of times branched down
+		int numberTimesDown() { return Derived->numberTimesDown(); }
+		/// Set the number of times branched down
+		void setNumberTimesDown(int value) { Derived->setNumberTimesDown(value); }
+		/// Get the number of times branched up
+		int numberTimesUp() { return Derived->numberTimesUp(); }
+		/// Set the number of times branched up
+		void setNumberTimesUp(int value) { Derived->setNumberTimesUp(value); }
+
+		/// Get the number of branches before the pseudocosts are trusted
+		int numberBeforeTrust() { return Derived->numberBeforeTrust(); }
+		/// Set the number of branches before the pseudocosts are trusted
+		void setNumberBeforeTrust(int value) { Derived->setNumberBeforeTrust(value); }
+
+	internal:
+		CbcSimpleIntegerDynamicPseudoCost() { }
+
+	protected:
+		property ::CbcSimpleIntegerDynamicPseudoCost * Derived
+		{
+			::CbcSimpleIntegerDynamicPseudoCost * get()
+			{
+				return dynamic_cast<::CbcSimpleIntegerDynamicPseudoCost*>(Base);
+			}
+		}
+	};
+
+	/// <summary>
+	/// A special ordered set (SOS) of the given columns.
+	/// In a solution of a set of type 1, at most one member is nonzero. In a set of type 2, at most two consecutive members 
+	/// (in the order of the weights) are nonzero. The weights must be distinct, and are increasing by default.
+	/// </summary>
+	public ref class CbcSOS : CbcObject
+	{
+	public:
+		/// Create a set of the given type (1 or 2) of the given columns, ordered by the given weights (null for 0, 1, 2, ..).
+		CbcSOS(CbcModel ^ model, array<int> ^ which, array<double> ^ weights, int identifier, int type);
+
+		/// Get the number of members
+		int numberMembers() { return Derived->numberMembers(); }
+		/// Get the columns of the members
+		array<int> ^ members();
+		/// Get the weights of the members
+		array<double> ^ weights();
+		/// Get the type of the set: 1 or 2
+		int sosType() { return Derived->sosType(); }
+
+	internal:
+		CbcSOS() { }
+
+	protected:
+		property ::CbcSOS * Derived
+		{
+			::CbcSOS * get()
+			{
+				return dynamic_cast<::CbcSOS*>(Base);
+			}
+		}
+	};
+}
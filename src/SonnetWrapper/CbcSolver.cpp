@@ -2,4 +2,57 @@
 // All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
-#include "CbcSolver.h"
\ No newline at end of file
+#include "CbcSolver.h"
+
+namespace COIN
+{
+	bool CbcSolverSession::prepare(array<System::String ^> ^args, CbcModel ^ cbcModel)
+	{
+		if (cbcModel == nullptr) throw gcnew ArgumentNullException("cbcModel");
+
+		bool sameArguments = (arguments != nullptr && args != nullptr && arguments->Length == args->Length);
+		for (int i = 0; sameArguments && i < args->Length; i++)
+		{
+			sameArguments = System::String::Equals(arguments[i], args[i]);
+		}
+
+		if (cbcData != nullptr && Object::ReferenceEquals(modelKey, cbcModel) && model == cbcModel->Base && sameArguments) return false;
+
+		// CbcMain1 keeps the parameters set by the arguments, so a change of arguments needs a new setup
+		reset();
+
+		argStrings->clear();
+		if (args != nullptr)
+		{
+			for (int i = 0; i < args->Length; i++) argStrings->push_back(marshal_as<std::string>(args[i]));
+		}
+		argv->clear();
+		for (size_t i = 0; i < argStrings->size(); i++) argv->push_back((*argStrings)[i].c_str());
+		arguments = (args != nullptr) ? (array<System::String ^> ^)args->Clone() : nullptr;
+
+		model = cbcModel->Base;
+		modelKey = cbcModel;
+		cbcData = new CbcSolverUsefulData();
+		::CbcMain0(*model, *cbcData);
+		setups++;
+		return true;
+	}
+
+	int CbcSolverSession::CbcMain1()
+	{
+		if (cbcData == nullptr) throw gcnew InvalidOperationException("The session is not prepared.");
+
+		int argc = (int)argv->size();
+		CglCutGeneratorProxy::startSolve(*model);
+		return ::CbcMain1(argc, (argc > 0) ? &(*argv)[0] : nullptr, *model, *cbcData);
+	}
+
+	void CbcSolverSession::reset()
+	{
+		delete cbcData;
+		cbcData = nullptr;
+		model = nullptr;
+		modelKey = nullptr;
+		arguments = nullptr;
+	}
+}
@@ -52,6 +52,7 @@ namespace COIN
 //					(char*)Marshal::StringToHGlobalAnsi(args[i]).ToPointer();
 			}
 
+			CglCutGeneratorProxy::startSolve(*(cbcModel->Base));
 			int result = ::CbcMain(argc, argv, *(cbcModel->Base));
 			delete context;
 			delete []argv;
@@ -77,6 +78,7 @@ namespace COIN
 				//argv[i] = (char*)Marshal::StringToHGlobalAnsi(args[i]).ToPointer();
 			}
 			CbcSolverUsefulData cbcData;
+			CglCutGeneratorProxy::startSolve(*(cbcModel->Base));
 			int result = ::CbcMain1(argc, argv, *(cbcModel->Base), cbcData);
 			delete context;
 			delete []argv;
@@ -84,4 +86,79 @@ namespace COIN
 			return result;
 		}
 	};
+
+	/// <summary>
+	/// A persistent CbcMain setup for repeated solves of the same CbcModel with the same arguments.
+	/// The CbcSolverUsefulData (incl. the parameter tables) and the marshalled arguments are kept alive across solves,
+	/// such that CbcMain0 and the marshalling of the arguments are only done for the first solve, 
+	/// or when the model or the arguments change.
+	/// The model is identified by its CbcModel object (see OsiCbcSolverInterface.getModelPtr), not by the native pointer alone,
+	/// since another native model can be allocated at the address of a deleted one.
+	/// </summary>
+	public ref class CbcSolverSession : public IDisposable
+	{
+	public:
+		CbcSolverSession()
+		{
+			cbcData = nullptr;
+			argStrings = new std::vector<std::string>();
+			argv = new std::vector<const char *>();
+			model = nullptr;
+			modelKey = nullptr;
+			arguments = nullptr;
+			setups = 0;
+			disposed = 0;
+		}
+
+		/// <summary>
+		/// Prepare the session to solve the given model with the given arguments (including the leading program name).
+		/// If this is the first solve, or the model or the arguments changed, a new CbcSolverUsefulData is set up via CbcMain0.
+		/// Otherwise, the setup of the previous solve is reused. Returns true if a new setup was done.
+		/// CbcMain0 changes settings of the model, so save any state to restore after the solve after this call.
+		/// </summary>
+		bool prepare(array<System::String ^> ^args, CbcModel ^ cbcModel);
+
+		/// <summary>
+		/// Solve the model given to prepare, with the arguments given to prepare, via CbcMain1.
+		/// </summary>
+		int CbcMain1();
+
+		/// <summary>
+		/// Discard the current setup, such that the next prepare does a new setup.
+		/// </summary>
+		void reset();
+
+		/// <summary>
+		/// The number of setups (CbcMain0) done by this session.
+		/// </summary>
+		int numberSetups() { return setups; }
+
+	private:
+		CbcSolverUsefulData *cbcData;
+		std::vector<std::string> *argStrings;
+		std::vector<const char *> *argv;
+		::CbcModel *model;
+		CbcModel ^modelKey;
+		array<System::String ^> ^arguments;
+		int setups;
+
+		int disposed;
+		~CbcSolverSession()
+		{
+			if (disposed > 0) return;
+			disposed++;
+
+			this->!CbcSolverSession();
+		}
+
+		!CbcSolverSession()
+		{
+			delete cbcData;
+			cbcData = nullptr;
+			delete argStrings;
+			argStrings = nullptr;
+			delete argv;
+			argv = nullptr;
+		}
+	};
 }
\ No newline at end of file
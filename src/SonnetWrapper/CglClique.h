@@ -0,0 +1,41 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CglClique.hpp>
+
+#include "CglCutGenerator.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// Clique cuts, from the star cliques and the row cliques of the conflict graph.
+	/// </summary>
+	public ref class CglClique : public CglCutGeneratorGeneric<::CglClique>
+	{
+	public:
+		CglClique() {}
+
+		/// Set whether to do the star cliques (default true)
+		void setDoStarClique(bool yesno) { Base->setDoStarClique(yesno); }
+		/// Set whether to do the row cliques (default true)
+		void setDoRowClique(bool yesno) { Base->setDoRowClique(yesno); }
+		/// Set the maximum length of the candidate list for the star cliques (default 12)
+		void setStarCliqueCandidateLengthThreshold(int maxlen) { Base->setStarCliqueCandidateLengthThreshold(maxlen); }
+		/// Set the maximum length of the candidate list for the row cliques (default 12)
+		void setRowCliqueCandidateLengthThreshold(int maxlen) { Base->setRowCliqueCandidateLengthThreshold(maxlen); }
+		/// Set whether to report on the star cliques
+		void setStarCliqueReport(bool yesno) { Base->setStarCliqueReport(yesno); }
+		/// Set whether to report on the row cliques
+		void setRowCliqueReport(bool yesno) { Base->setRowCliqueReport(yesno); }
+		/// Set the minimum violation of a cut (default 0.0)
+		void setMinViolation(double value) { Base->setMinViolation(value); }
+		/// Get the minimum violation of a cut
+		double getMinViolation() { return Base->getMinViolation(); }
+	};
+}
\ No newline at end of file
@@ -2,10 +2,16 @@
 // All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
-#include <CglProbing.hpp>
-
 #include "CglCutGenerator.h"
 #include "CglProbing.h"
+#include "CglGomory.h"
+#include "CglMixedIntegerRounding2.h"
+#include "CglKnapsackCover.h"
+#include "CglClique.h"
+#include "CglFlowCover.h"
+#include "CglTwomir.h"
+#include "CglZeroHalf.h"
+#include "CglRedSplit.h"
 
 namespace COIN
 {
@@ -18,6 +24,62 @@ namespace COIN
 			result->TransferBase();
 			return result;
 		}
+		else if (dynamic_cast<::CglGomory *>(derived) != nullptr)
+		{
+			CglCutGenerator ^ result = gcnew CglGomory();
+			result->Base = (::CglGomory *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CglMixedIntegerRounding2 *>(derived) != nullptr)
+		{
+			CglCutGenerator ^ result = gcnew CglMixedIntegerRounding2();
+			result->Base = (::CglMixedIntegerRounding2 *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CglKnapsackCover *>(derived) != nullptr)
+		{
+			CglCutGenerator ^ result = gcnew CglKnapsackCover();
+			result->Base = (::CglKnapsackCover *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CglClique *>(derived) != nullptr)
+		{
+			CglCutGenerator ^ result = gcnew CglClique();
+			result->Base = (::CglClique *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CglFlowCover *>(derived) != nullptr)
+		{
+			CglCutGenerator ^ result = gcnew CglFlowCover();
+			result->Base = (::CglFlowCover *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CglTwomir *>(derived) != nullptr)
+		{
+			CglCutGenerator ^ result = gcnew CglTwomir();
+			result->Base = (::CglTwomir *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CglZeroHalf *>(derived) != nullptr)
+		{
+			CglCutGenerator ^ result = gcnew CglZeroHalf();
+			result->Base = (::CglZeroHalf *)(derived);
+			result->TransferBase();
+			return result;
+		}
+		else if (dynamic_cast<::CglRedSplit *>(derived) != nullptr)
+		{
+			CglCutGenerator ^ result = gcnew CglRedSplit();
+			result->Base = (::CglRedSplit *)(derived);
+			result->TransferBase();
+			return result;
+		}
 		else
 		{
 			CglCutGenerator ^ result = gcnew CglCutGenerator();
@@ -0,0 +1,29 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CglFlowCover.hpp>
+
+#include "CglCutGenerator.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// Lifted simple generalized flow cover cuts.
+	/// </summary>
+	public ref class CglFlowCover : public CglCutGeneratorGeneric<::CglFlowCover>
+	{
+	public:
+		CglFlowCover() {}
+
+		/// Set the maximum number of cuts per call (default 2000)
+		void setMaxNumCuts(int value) { Base->setMaxNumCuts(value); }
+		/// Get the maximum number of cuts per call
+		int getMaxNumCuts() { return Base->getMaxNumCuts(); }
+	};
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CglGomory.hpp>
+
+#include "CglCutGenerator.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// Gomory mixed integer cuts from the optimal tableau.
+	/// </summary>
+	public ref class CglGomory : public CglCutGeneratorGeneric<::CglGomory>
+	{
+	public:
+		CglGomory() {}
+
+		/// Set the maximum number of nonzero coefficients in a cut (default 50)
+		void setLimit(int limit) { Base->setLimit(limit); }
+		/// Get the maximum number of nonzero coefficients in a cut
+		int getLimit() { return Base->getLimit(); }
+		/// Set the maximum number of nonzero coefficients in a cut at the root (default 0, use the limit)
+		void setLimitAtRoot(int limit) { Base->setLimitAtRoot(limit); }
+		/// Get the maximum number of nonzero coefficients in a cut at the root
+		int getLimitAtRoot() { return Base->getLimitAtRoot(); }
+		/// Set the minimum fractionality of a basic integer variable to generate a cut from (default 0.05)
+		void setAway(double value) { Base->setAway(value); }
+		/// Get the minimum fractionality of a basic integer variable to generate a cut from
+		double getAway() { return Base->getAway(); }
+		/// Set the minimum fractionality at the root (default 0.05)
+		void setAwayAtRoot(double value) { Base->setAwayAtRoot(value); }
+		/// Get the minimum fractionality at the root
+		double getAwayAtRoot() { return Base->getAwayAtRoot(); }
+		/// Set the multiplier of the condition number: no cuts if the basis is worse conditioned than this (default 1.0e-18)
+		void setConditionNumberMultiplier(double value) { Base->setConditionNumberMultiplier(value); }
+		/// Get the multiplier of the condition number
+		double getConditionNumberMultiplier() { return Base->getConditionNumberMultiplier(); }
+		/// Set the multiplier of the largest factor, for the acceptance of the ratio of coefficients in a cut (default 1.0e-13)
+		void setLargestFactorMultiplier(double value) { Base->setLargestFactorMultiplier(value); }
+		/// Get the multiplier of the largest factor
+		double getLargestFactorMultiplier() { return Base->getLargestFactorMultiplier(); }
+	};
+}
\ No newline at end of file
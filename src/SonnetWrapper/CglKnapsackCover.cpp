@@ -0,0 +1,5 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CglKnapsackCover.h"
\ No newline at end of file
@@ -0,0 +1,33 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CglKnapsackCover.hpp>
+
+#include "CglCutGenerator.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// Lifted knapsack cover cuts.
+	/// </summary>
+	public ref class CglKnapsackCover : public CglCutGeneratorGeneric<::CglKnapsackCover>
+	{
+	public:
+		CglKnapsackCover() {}
+
+		/// Set the maximum number of variables in a knapsack (row) to be considered (default 50)
+		void setMaxInKnapsack(int value) { Base->setMaxInKnapsack(value); }
+		/// Get the maximum number of variables in a knapsack (row) to be considered
+		int getMaxInKnapsack() { return Base->getMaxInKnapsack(); }
+		/// Switch off the expensive cuts
+		void switchOffExpensive() { Base->switchOffExpensive(); }
+		/// Switch on the expensive cuts
+		void switchOnExpensive() { Base->switchOnExpensive(); }
+	};
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <OsiSolverInterface.hpp>
+#include <OsiRowCut.hpp>
+#include <CbcCutGenerator.hpp>
+
+#include "CglManagedCutGenerator.h"
+
+namespace COIN
+{
+#pragma managed(push, off)
+	// The cuts are collected and appended in native code, such that there is only one transition to managed code per call.
+
+	CglCutBatch::CglCutBatch()
+	{
+		solver = nullptr;
+		level = 0;
+		pass = 0;
+		inTree = false;
+		callback = nullptr;
+		globallyValid = false;
+		solveNumber = 0;
+		rowStarts.push_back(0);
+	}
+
+	void CglCutBatch::clear()
+	{
+		rowStarts.resize(1);
+		columns.clear();
+		elements.clear();
+		cutLower.clear();
+		cutUpper.clear();
+	}
+
+	void CglCutBatch::addCut(int numberElements, const int * columns, const double * elements, double lower, double upper)
+	{
+		this->columns.insert(this->columns.end(), columns, columns + numberElements);
+		this->elements.insert(this->elements.end(), elements, elements + numberElements);
+		rowStarts.push_back((int)this->columns.size());
+		cutLower.push_back(lower);
+		cutUpper.push_back(upper);
+	}
+
+	int CglCutBatch::appendTo(OsiCuts & cs, bool globallyValid) const
+	{
+		int n = numberCuts();
+		for (int i = 0; i < n; i++)
+		{
+			int start = rowStarts[i];
+			int length = rowStarts[i + 1] - start;
+
+			OsiRowCut cut;
+			cut.setRow(length, (length > 0) ? &columns[start] : nullptr, (length > 0) ? &elements[start] : nullptr, false);
+			cut.setLb(cutLower[i]);
+			cut.setUb(cutUpper[i]);
+			cut.setGloballyValid(globallyValid);
+			cs.insert(cut);
+		}
+		return n;
+	}
+
+	CglCutGeneratorProxy::CglCutGeneratorProxy(const std::shared_ptr<CglCutBatch> & batch)
+		: ::CglCutGenerator()
+	{
+		this->batch = batch;
+	}
+
+	CglCutGeneratorProxy::CglCutGeneratorProxy(const CglCutGeneratorProxy& rhs)
+		: ::CglCutGenerator(rhs)
+	{
+		this->batch = rhs.batch;
+	}
+
+	CglCutGeneratorProxy& CglCutGeneratorProxy::operator=(const CglCutGeneratorProxy& rhs)
+	{
+		if (this != &rhs)
+		{
+			::CglCutGenerator::operator=(rhs);
+			this->batch = rhs.batch;
+		}
+		return *this;
+	}
+
+	::CglCutGenerator * CglCutGeneratorProxy::clone() const
+	{
+		return new CglCutGeneratorProxy(*this);
+	}
+
+	void CglCutGeneratorProxy::generateCuts(const ::OsiSolverInterface & si, OsiCuts & cs, const CglTreeInfo info)
+	{
+		if (batch->callback == nullptr) return;
+
+		batch->clear();
+		batch->solver = &si;
+		batch->level = info.level;
+		batch->pass = info.pass;
+		batch->inTree = info.inTree;
+
+		batch->callback();
+
+		batch->solver = nullptr;
+		batch->appendTo(cs, batch->globallyValid);
+		batch->clear();
+	}
+
+	void CglCutGeneratorProxy::startSolve(::CbcModel & model)
+	{
+		for (int i = 0; i < model.numberCutGenerators(); i++)
+		{
+			CglCutGeneratorProxy * proxy = dynamic_cast<CglCutGeneratorProxy *>(model.cutGenerator(i)->generator());
+			if (proxy != nullptr) proxy->batch->solveNumber++;
+		}
+	}
+#pragma managed(pop)
+
+	CglManagedCutGenerator::CglManagedCutGenerator()
+	{
+		sharedBatch = new std::shared_ptr<CglCutBatch>(new CglCutBatch());
+		batch = sharedBatch->get();
+		exceptionSolve = -1;
+		Base = new CglCutGeneratorProxy(*sharedBatch);
+
+		// the delegate is kept alive by this object, and the function pointer is valid as long as the delegate is
+		callback = gcnew CutCallback(this, &CglManagedCutGenerator::OnGenerateCuts);
+		batch->callback = (CglCutCallback)Marshal::GetFunctionPointerForDelegate(callback).ToPointer();
+	}
+
+	void CglManagedCutGenerator::OnGenerateCuts()
+	{
+		// exceptions cannot pass through the native branch and bound: keep the exception, and add no cuts
+		try
+		{
+			generateCuts();
+		}
+		catch (Exception ^ e)
+		{
+			exception = e;
+			exceptionSolve = batch->solveNumber;
+			batch->clear();
+		}
+	}
+
+	const ::OsiSolverInterface * CglManagedCutGenerator::nodeSolver()
+	{
+		if (batch->solver == nullptr) throw gcnew InvalidOperationException("The node LP is only available during generateCuts.");
+		return batch->solver;
+	}
+
+	int CglManagedCutGenerator::getNumCols()
+	{
+		return nodeSolver()->getNumCols();
+	}
+
+	int CglManagedCutGenerator::getNumRows()
+	{
+		return nodeSolver()->getNumRows();
+	}
+
+	const double * CglManagedCutGenerator::getColSolutionUnsafe()
+	{
+		return nodeSolver()->getColSolution();
+	}
+
+	double CglManagedCutGenerator::colSolution(int j)
+	{
+		const ::OsiSolverInterface * solver = nodeSolver();
+		if (j < 0 || j >= solver->getNumCols()) throw gcnew ArgumentOutOfRangeException("j");
+		return solver->getColSolution()[j];
+	}
+
+	array<double> ^ CglManagedCutGenerator::getColSolution()
+	{
+		const ::OsiSolverInterface * solver = nodeSolver();
+		int n = solver->getNumCols();
+		array<double> ^ result = gcnew array<double>(n);
+		if (n > 0) Marshal::Copy(IntPtr((void *)solver->getColSolution()), result, 0, n);
+		return result;
+	}
+
+	void CglManagedCutGenerator::addCut(array<int> ^ columns, array<double> ^ elements, double lower, double upper)
+	{
+		if (columns == nullptr) throw gcnew ArgumentNullException("columns");
+		if (elements == nullptr || elements->Length != columns->Length) throw gcnew ArgumentException("The number of elements should equal the number of columns.", "elements");
+
+		if (columns->Length == 0)
+		{
+			batch->addCut(0, nullptr, nullptr, lower, upper);
+			return;
+		}
+
+		pin_ptr<int> columnsPtr = &columns[0];
+		pin_ptr<double> elementsPtr = &elements[0];
+		batch->addCut(columns->Length, columnsPtr, elementsPtr, lower, upper);
+	}
+
+	void CglManagedCutGenerator::addCutUnsafe(int numberElements, const int * columns, const double * elements, double lower, double upper)
+	{
+		batch->addCut(numberElements, columns, elements, lower, upper);
+	}
+}
@@ -0,0 +1,158 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <CglCutGenerator.hpp>
+#include <CglTreeInfo.hpp>
+#include <OsiCuts.hpp>
+#include <CbcModel.hpp>
+
+#include "CglCutGenerator.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	typedef void (__stdcall *CglCutCallback)();
+
+	/// The node LP that is separated, and the cuts found for it as one packed (CSR) batch.
+	class CglCutBatch
+	{
+	public:
+		CglCutBatch();
+
+		void clear();
+		void addCut(int numberElements, const int * columns, const double * elements, double lower, double upper);
+		/// Append the cuts of the batch to the given cuts, and return the number of cuts appended
+		int appendTo(OsiCuts & cs, bool globallyValid) const;
+
+		int numberCuts() const { return (int)cutLower.size(); }
+
+		/// The view of the current node, only valid during the callback
+		const ::OsiSolverInterface * solver;
+		int level;
+		int pass;
+		bool inTree;
+
+		CglCutCallback callback;
+		bool globallyValid;
+		/// The number of solves started with this batch, see CglCutGeneratorProxy::startSolve
+		int solveNumber;
+
+	private:
+		std::vector<int> rowStarts;
+		std::vector<int> columns;
+		std::vector<double> elements;
+		std::vector<double> cutLower;
+		std::vector<double> cutUpper;
+	};
+
+	class CglCutGeneratorProxy : public ::CglCutGenerator
+	{
+	public:
+		CglCutGeneratorProxy(const std::shared_ptr<CglCutBatch> & batch);
+
+		/** The copy constructor */
+		CglCutGeneratorProxy(const CglCutGeneratorProxy& rhs);
+
+		/** Assignment operator. */
+		CglCutGeneratorProxy& operator=(const CglCutGeneratorProxy& rhs);
+
+		virtual ::CglCutGenerator * clone() const;
+
+		virtual void generateCuts(const ::OsiSolverInterface & si, OsiCuts & cs, const CglTreeInfo info = CglTreeInfo());
+
+		/// Mark the start of a solve of the given model for the managed cut generators of the model
+		static void startSolve(::CbcModel & model);
+
+	private:
+		// shared by all clones and the managed CglManagedCutGenerator, such that clones in a model can outlive it
+		std::shared_ptr<CglCutBatch> batch;
+	};
+
+	/// <summary>
+	/// The base class for cut generators written in .NET. Override generateCuts to separate the current node LP: 
+	/// read its solution via getColSolution, colSolution or getColSolutionUnsafe (a view of the native solution, without copy), 
+	/// and add the violated cuts via addCut. After generateCuts returns, the cuts are appended natively to the cuts of Cbc, 
+	/// as one batch. Add the generator to a model via CbcModel::addCutGenerator (with atSolution true for lazy constraints),
+	/// or to every MIP solve of a Sonnet Solver via Solver.AddCutGenerator, since the reset after a solve removes it from the model.
+	/// The model stores a copy that calls back into this object, so keep this object alive (and not disposed) while 
+	/// the model is used: after this object is disposed, the copies add no cuts.
+	/// Exceptions in generateCuts are not passed through Cbc: see callbackException.
+	/// </summary>
+	public ref class CglManagedCutGenerator abstract : CglCutGenerator
+	{
+	public:
+		CglManagedCutGenerator();
+
+		/// Set whether the cuts are globally valid (default false: only valid in the subtree of the node)
+		void setGloballyValid(bool value) { batch->globallyValid = value; }
+		/// Get whether the cuts are globally valid
+		bool globallyValid() { return batch->globallyValid; }
+
+		/// Get the exception of the last generateCuts that failed during the last solve, if any.
+		/// The branch and bound continues after a failed generateCuts, so later calls that succeed do not clear it.
+		/// A new solve via CbcModel::branchAndBound or CbcMain1 clears it.
+		Exception ^ callbackException() { return (exceptionSolve == batch->solveNumber) ? exception : nullptr; }
+
+	protected:
+		/// Separate the current node LP: add violated cuts via addCut
+		virtual void generateCuts() abstract;
+
+		/// Get the number of columns of the current node LP (only during generateCuts)
+		int getNumCols();
+		/// Get the number of rows of the current node LP, incl. the cuts (only during generateCuts)
+		int getNumRows();
+		/// Get the solution of the current node LP, without copy (only during generateCuts)
+		const double * getColSolutionUnsafe();
+		/// Get the value of the given column in the solution of the current node LP (only during generateCuts)
+		double colSolution(int j);
+		/// Get a copy of the solution of the current node LP (only during generateCuts)
+		array<double> ^ getColSolution();
+		/// Get the depth of the current node (0 at the root)
+		int level() { return batch->level; }
+		/// Get the number of the current pass of cut generation at this node
+		int pass() { return batch->pass; }
+		/// Get whether the current node is in the tree (not at the root)
+		bool inTree() { return batch->inTree; }
+
+		/// Add the cut lower &lt;= sum elements[k] * x[columns[k]] &lt;= upper
+		void addCut(array<int> ^ columns, array<double> ^ elements, double lower, double upper);
+		/// Add the cut lower &lt;= sum elements[k] * x[columns[k]] &lt;= upper, for k &lt; numberElements
+		void addCutUnsafe(int numberElements, const int * columns, const double * elements, double lower, double upper);
+		/// Get the number of cuts added during this generateCuts
+		int numberCuts() { return batch->numberCuts(); }
+
+	private:
+		[UnmanagedFunctionPointer(CallingConvention::StdCall)]
+		delegate void CutCallback();
+
+		void OnGenerateCuts();
+		const ::OsiSolverInterface * nodeSolver();
+
+		std::shared_ptr<CglCutBatch> * sharedBatch;
+		CglCutBatch * batch;
+		CutCallback ^ callback;
+		Exception ^ exception;
+		int exceptionSolve;
+
+		~CglManagedCutGenerator()
+		{
+			this->!CglManagedCutGenerator();
+		}
+
+		!CglManagedCutGenerator()
+		{
+			// the copies in models keep the batch alive, but can no longer call back
+			if (batch != nullptr) batch->callback = nullptr;
+			delete sharedBatch;
+			sharedBatch = nullptr;
+			batch = nullptr;
+		}
+	};
+}
@@ -0,0 +1,41 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CglMixedIntegerRounding2.hpp>
+
+#include "CglCutGenerator.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// Mixed integer rounding cuts (version 2, using dense vectors).
+	/// </summary>
+	public ref class CglMixedIntegerRounding2 : public CglCutGeneratorGeneric<::CglMixedIntegerRounding2>
+	{
+	public:
+		CglMixedIntegerRounding2() {}
+
+		/// Set the maximum number of rows to aggregate (default 1)
+		void setMAXAGGR_(int maxaggr) { Base->setMAXAGGR_(maxaggr); }
+		/// Get the maximum number of rows to aggregate
+		int getMAXAGGR_() { return Base->getMAXAGGR_(); }
+		/// Set whether to multiply the rows by -1 (default true)
+		void setMULTIPLY_(bool multiply) { Base->setMULTIPLY_(multiply); }
+		/// Get whether to multiply the rows by -1
+		bool getMULTIPLY_() { return Base->getMULTIPLY_(); }
+		/// Set the criterion for the selection of rows to aggregate: 1, 2, 3 (default 1)
+		void setCRITERION_(int criterion) { Base->setCRITERION_(criterion); }
+		/// Get the criterion for the selection of rows to aggregate
+		int getCRITERION_() { return Base->getCRITERION_(); }
+		/// Set the preprocessing: -1 only at the root (default), 0 never, 1 always
+		void setDoPreproc(int value) { Base->setDoPreproc(value); }
+		/// Get the preprocessing
+		bool getDoPreproc() { return Base->getDoPreproc(); }
+	};
+}
\ No newline at end of file
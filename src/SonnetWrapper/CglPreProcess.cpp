@@ -0,0 +1,60 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CglPreProcess.h"
+
+namespace COIN
+{
+	OsiSolverInterface^ CglPreProcess::preProcess(OsiSolverInterface^ model, bool makeEquality, int numberPasses)
+	{
+		try
+		{
+			::OsiSolverInterface* processed = Base->preProcess(*model->Base, makeEquality, numberPasses);
+			if (!processed) return nullptr;
+
+			numberProcessedColumns = processed->getNumCols();
+			numberProcessedRows = processed->getNumRows();
+			// The preprocessed model is owned by the CglPreProcess
+			return OsiSolverInterface::CreateDerived(processed);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	OsiSolverInterface^ CglPreProcess::preProcessNonDefault(OsiSolverInterface^ model, int makeEquality, int numberPasses, int tuning)
+	{
+		try
+		{
+			::OsiSolverInterface* processed = Base->preProcessNonDefault(*model->Base, makeEquality, numberPasses, tuning);
+			if (!processed) return nullptr;
+
+			numberProcessedColumns = processed->getNumCols();
+			numberProcessedRows = processed->getNumRows();
+			// The preprocessed model is owned by the CglPreProcess
+			return OsiSolverInterface::CreateDerived(processed);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	array<int>^ CglPreProcess::originalColumns()
+	{
+		const int* original = Base->originalColumns();
+		array<int>^ result = gcnew array<int>(numberProcessedColumns);
+		if (original) for (int j = 0; j < numberProcessedColumns; j++) result[j] = original[j];
+		return result;
+	}
+
+	array<int>^ CglPreProcess::originalRows()
+	{
+		const int* original = Base->originalRows();
+		array<int>^ result = gcnew array<int>(numberProcessedRows);
+		if (original) for (int i = 0; i < numberProcessedRows; i++) result[i] = original[i];
+		return result;
+	}
+}
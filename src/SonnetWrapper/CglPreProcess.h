@@ -0,0 +1,149 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CglPreProcess.hpp>
+
+#include "CglCutGenerator.h"
+#include "OsiSolverInterface.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// The options of CglPreProcess, see setOptions.
+	/// </summary>
+	[Flags]
+	public enum class CglPreProcessOptions
+	{
+		/// <summary>
+		/// Default: do probing, duplicate rows and cliques
+		/// </summary>
+		None = 0,
+		/// <summary>
+		/// The original model had integer bounds before tightening
+		/// </summary>
+		IntegerBounds = 1,
+		/// <summary>
+		/// Don't do probing
+		/// </summary>
+		NoProbing = 2,
+		/// <summary>
+		/// Don't do duplicate rows
+		/// </summary>
+		NoDuplicateRows = 4,
+		/// <summary>
+		/// Don't do cliques (incl. merging of cliques)
+		/// </summary>
+		NoCliques = 8,
+		/// <summary>
+		/// Some heavy probing options
+		/// </summary>
+		HeavyProbing = 16,
+		/// <summary>
+		/// Very heavy probing
+		/// </summary>
+		VeryHeavyProbing = 64
+	};
+
+	/// <summary>
+	/// The MIP preprocessing of Cgl: probing, clique processing, coefficient tightening (by the cut generators added,
+	/// typically CglProbing), duplicate rows, and presolve. preProcess(..) returns the preprocessed model, 
+	/// and after branch and bound on (a copy of) that model, postProcess(..) puts the solution back into the original model.
+	/// The preprocessed models are owned by this object.
+	/// </summary>
+	public ref class CglPreProcess : WrapperBase<::CglPreProcess>
+	{
+	public:
+		/// Default constructor
+		CglPreProcess() 
+		{
+			numberProcessedColumns = 0;
+			numberProcessedRows = 0;
+		}
+
+		/// <summary>
+		/// Preprocess the model with the default cut generator (CglProbing), and returns the preprocessed model,
+		/// or null if the model was found to be infeasible. 
+		/// If makeEquality is true, then &lt;= cliques are converted to ==. Presolve is done numberPasses times.
+		/// </summary>
+		OsiSolverInterface^ preProcess(OsiSolverInterface^ model, bool makeEquality, int numberPasses);
+
+		/// <summary>
+		/// Preprocess the model using the cut generators added (see addCutGenerator), and returns the preprocessed model,
+		/// or null if the model was found to be infeasible.
+		/// If makeEquality is 1, then slacks are added to get cliques; if 2, then slacks are added to get SOS (if that looks plausible).
+		/// Presolve is done numberPasses times. For the tuning, see CglPreProcess.
+		/// </summary>
+		OsiSolverInterface^ preProcessNonDefault(OsiSolverInterface^ model, int makeEquality, int numberPasses, int tuning);
+
+		/// <summary>
+		/// Creates the solution in the original model, from the solution of the given (preprocessed) model.
+		/// </summary>
+		void postProcess(OsiSolverInterface^ model)
+		{
+			postProcess(model, 2);
+		}
+
+		/// <summary>
+		/// Creates the solution in the original model, from the solution of the given (preprocessed) model.
+		/// If deleteStuff is 0, then the preprocessed models are kept; 1 deletes these, and 2 (default) also deletes the other data.
+		/// </summary>
+		void postProcess(OsiSolverInterface^ model, int deleteStuff)
+		{
+			try
+			{
+				Base->postProcess(*model->Base, deleteStuff);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		/// <summary>
+		/// Add a cut generator to be used by preProcessNonDefault, typically CglProbing. A copy of the generator is stored.
+		/// </summary>
+		void addCutGenerator(CglCutGenerator^ generator)
+		{
+			Base->addCutGenerator(generator->Base);
+		}
+
+		/// <summary>
+		/// Returns for each column of the preprocessed model the index of the corresponding column in the original model.
+		/// </summary>
+		array<int>^ originalColumns();
+
+		/// <summary>
+		/// Returns for each row of the preprocessed model the index of the corresponding row in the original model.
+		/// </summary>
+		array<int>^ originalRows();
+
+		/// Set the options, see CglPreProcessOptions
+		void setOptions(CglPreProcessOptions value) { Base->setOptions((int)value); }
+		/// Get the options
+		CglPreProcessOptions getOptions() { return (CglPreProcessOptions)Base->options(); }
+
+		/// Set the cutoff, used in probing
+		void setCutoff(double value) { Base->setCutoff(value); }
+		/// Get the cutoff
+		double getCutoff() { return Base->cutoff(); }
+
+		/// Keep the column names in the preprocessed model (or not)
+		void setKeepColumnNames(bool keep) { Base->setKeepColumnNames(keep); }
+
+		/// <summary>
+		/// Pass in a message handler. It is the user's responsibility to keep the handler alive, and to delete it.
+		/// </summary>
+		void passInMessageHandler(CoinMessageHandler^ handler) { Base->passInMessageHandler(handler->Base); }
+
+	private:
+		int numberProcessedColumns;
+		int numberProcessedRows;
+	};
+}
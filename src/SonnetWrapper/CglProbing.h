@@ -26,6 +26,15 @@ namespace COIN
 			-1 don't even think about it
 		*/
 		void setUsingObjective(int yesNo) { Base->setUsingObjective(yesNo); }
+		/**@name Row cuts */
+		/** Set
+			0 no cuts
+			1 just disaggregation type
+			2 coefficient ( 3 both)
+		*/
+		void setRowCuts(int type) { Base->setRowCuts(type); }
+		/// Get
+		int rowCuts() { return Base->rowCuts(); }
 		/**@name Change maxima */
 		//@{
 		/// Set maximum number of passes per node
@@ -0,0 +1,41 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CglRedSplit.hpp>
+
+#include "CglCutGenerator.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// Reduce-and-split cuts from the optimal tableau.
+	/// </summary>
+	public ref class CglRedSplit : public CglCutGeneratorGeneric<::CglRedSplit>
+	{
+	public:
+		CglRedSplit() {}
+
+		/// Set the maximum number of nonzero coefficients in a cut (default 50)
+		void setLimit(int limit) { Base->setLimit(limit); }
+		/// Get the maximum number of nonzero coefficients in a cut
+		int getLimit() { return Base->getLimit(); }
+		/// Set the minimum fractionality of a basic integer variable to generate a cut from (default 0.05)
+		void setAway(double value) { Base->setAway(value); }
+		/// Get the minimum fractionality of a basic integer variable to generate a cut from
+		double getAway() { return Base->getAway(); }
+		/// Set the maximum value of the bounds of variables in a cut (default 1.0e3)
+		void setLUB(double value) { Base->setLUB(value); }
+		/// Get the maximum value of the bounds of variables in a cut
+		double getLUB() { return Base->getLUB(); }
+		/// Set the maximum absolute value of the coefficients in the tableau, to reject numerically unstable rows (default 1.0e3)
+		void setMaxTab(double value) { Base->setMaxTab(value); }
+		/// Get the maximum absolute value of the coefficients in the tableau
+		double getMaxTab() { return Base->getMaxTab(); }
+	};
+}
\ No newline at end of file
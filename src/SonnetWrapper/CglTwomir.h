@@ -0,0 +1,51 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CglTwomir.hpp>
+
+#include "CglCutGenerator.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// Two-step mixed integer rounding cuts from the tableau and the formulation.
+	/// </summary>
+	public ref class CglTwomir : public CglCutGeneratorGeneric<::CglTwomir>
+	{
+	public:
+		CglTwomir() {}
+
+		/// Set the range of the scaling factors for MIR (default 1 to 1)
+		void setMirScale(int tmin, int tmax) { Base->setMirScale(tmin, tmax); }
+		/// Set the range of the scaling factors for two-step MIR (default 1 to 1)
+		void setTwomirScale(int qmin, int qmax) { Base->setTwomirScale(qmin, qmax); }
+		/// Set the maximum number of rows to aggregate (default 1)
+		void setAMax(int amax) { Base->setAMax(amax); }
+		/// Set the maximum number of nonzero coefficients in a cut
+		void setMaxElements(int maxElements) { Base->setMaxElements(maxElements); }
+		/// Set the maximum number of nonzero coefficients in a cut at the root
+		void setMaxElementsRoot(int maxElementsRoot) { Base->setMaxElementsRoot(maxElementsRoot); }
+		/// Set the types of cuts: MIR, two-step MIR, from the tableau, from the formulation
+		void setCutTypes(bool mir, bool twomir, bool tab, bool form) { Base->setCutTypes(mir, twomir, tab, form); }
+		/// Get the minimum MIR scaling factor
+		int getTmin() { return Base->getTmin(); }
+		/// Get the maximum MIR scaling factor
+		int getTmax() { return Base->getTmax(); }
+		/// Get the minimum two-step MIR scaling factor
+		int getQmin() { return Base->getQmin(); }
+		/// Get the maximum two-step MIR scaling factor
+		int getQmax() { return Base->getQmax(); }
+		/// Get the maximum number of rows to aggregate
+		int getAmax() { return Base->getAmax(); }
+		/// Get the maximum number of nonzero coefficients in a cut
+		int getMaxElements() { return Base->getMaxElements(); }
+		/// Get the maximum number of nonzero coefficients in a cut at the root
+		int getMaxElementsRoot() { return Base->getMaxElementsRoot(); }
+	};
+}
\ No newline at end of file
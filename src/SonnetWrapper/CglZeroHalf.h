@@ -0,0 +1,29 @@
+// Copyright (C) Jan-Willem Goossens 
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CglZeroHalf.hpp>
+
+#include "CglCutGenerator.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// Zero-half (0-1/2 Chvatal-Gomory) cuts.
+	/// </summary>
+	public ref class CglZeroHalf : public CglCutGeneratorGeneric<::CglZeroHalf>
+	{
+	public:
+		CglZeroHalf() {}
+
+		/// Set the flags, e.g., 1 for a limited search (default 0)
+		void setFlags(int value) { Base->setFlags(value); }
+		/// Get the flags
+		int getFlags() { return Base->getFlags(); }
+	};
+}
\ No newline at end of file
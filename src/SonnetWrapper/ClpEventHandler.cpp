@@ -0,0 +1,20 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <intrin.h>
+
+#include "ClpEventHandler.h"
+
+namespace COIN
+{
+	void CoinStopFlag::stop()
+	{
+		_InterlockedExchange(stopFlag, 1);
+	}
+
+	void CoinStopFlag::reset()
+	{
+		_InterlockedExchange(stopFlag, 0);
+	}
+}
@@ -0,0 +1,157 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <ClpEventHandler.hpp>
+
+#include "Helpers.h"
+
+using namespace System;
+
+namespace COIN
+{
+	/// <summary>
+	/// This class is a native class derived from native ClpEventHandler.
+	/// It stops the Clp algorithm at the end of the next iteration once the given stop flag, or the chained flag (if any), is non-zero.
+	/// The stop flags are owned by the caller, are shared by all clones of the handler, and must outlive them.
+	/// Other events are passed to the chained handler (if any), such as the handler the model had before.
+	/// </summary>
+	public class ClpStopEventHandler : public ::ClpEventHandler
+	{
+	public:
+		ClpStopEventHandler(volatile long *stopFlag)
+			: ::ClpEventHandler()
+		{
+			this->stopFlag = stopFlag;
+			this->chainedFlag = nullptr;
+			this->chained = nullptr;
+		}
+
+		ClpStopEventHandler(volatile long *stopFlag, volatile long *chainedFlag)
+			: ::ClpEventHandler()
+		{
+			this->stopFlag = stopFlag;
+			this->chainedFlag = chainedFlag;
+			this->chained = nullptr;
+		}
+
+		/** The copy constructor */
+		ClpStopEventHandler(const ClpStopEventHandler& rhs)
+			: ::ClpEventHandler(rhs)
+		{
+			this->stopFlag = rhs.stopFlag;
+			this->chainedFlag = rhs.chainedFlag;
+			this->chained = rhs.chained != nullptr ? rhs.chained->clone() : nullptr;
+		}
+
+		virtual ~ClpStopEventHandler()
+		{
+			delete chained;
+		}
+
+		/** Assignment operator. */
+		ClpStopEventHandler& operator=(const ClpStopEventHandler& rhs)
+		{
+			if (this != &rhs)
+			{
+				::ClpEventHandler::operator=(rhs);
+				this->stopFlag = rhs.stopFlag;
+				this->chainedFlag = rhs.chainedFlag;
+				setChainedHandler(rhs.chained);
+			}
+			return *this;
+		}
+
+		/// Set the handler to pass the other events to. This handler stores a copy.
+		void setChainedHandler(const ::ClpEventHandler *handler)
+		{
+			::ClpEventHandler * copy = handler != nullptr ? handler->clone() : nullptr;
+			delete chained;
+			chained = copy;
+		}
+
+		/// Get the handler the other events are passed to, or null
+		const ::ClpEventHandler * chainedHandler() const { return chained; }
+
+		/// Clone
+		virtual ::ClpEventHandler * clone() const
+		{
+			return new ClpStopEventHandler(*this);
+		}
+
+		/** Returns -1 to carry on, or 0 to stop (Clp then sets status 5: stopped by event) */
+		virtual int event(Event whichEvent)
+		{
+			if (whichEvent == endOfIteration && (*stopFlag != 0 || (chainedFlag != nullptr && *chainedFlag != 0))) return 0;
+			if (chained == nullptr) return -1;
+
+			// the model is set on this handler by ClpModel::passInEventHandler, and may have been copied since
+			chained->setSimplex(model_);
+			return chained->event(whichEvent);
+		}
+
+		virtual int eventWithInfo(Event whichEvent, void *info)
+		{
+			if (chained == nullptr) return ::ClpEventHandler::eventWithInfo(whichEvent, info);
+
+			chained->setSimplex(model_);
+			return chained->eventWithInfo(whichEvent, info);
+		}
+
+	private:
+		volatile long *stopFlag;
+		volatile long *chainedFlag;
+		::ClpEventHandler *chained;
+	};
+
+	/// <summary>
+	/// A native stop flag that can be raised from any thread, to stop running Clp and Cbc algorithms.
+	/// Pass it to a model via ClpModel::passInStopFlag or CbcModel::passInStopFlag, which install event handlers on the flag.
+	/// Keep this object alive (and not disposed) while the models can use it.
+	/// </summary>
+	public ref class CoinStopFlag : public IDisposable
+	{
+	public:
+		CoinStopFlag()
+		{
+			stopFlag = new long(0);
+			disposed = 0;
+		}
+
+		/// Raise the flag. Can be called from any thread.
+		void stop();
+		/// Lower the flag, for example before the next solve
+		void reset();
+		/// Returns true if the flag is raised
+		bool isStopped() { return *stopFlag != 0; }
+
+	internal:
+		property volatile long * Flag
+		{
+			volatile long * get()
+			{
+				return stopFlag;
+			}
+		}
+
+	private:
+		volatile long *stopFlag;
+
+		int disposed;
+		~CoinStopFlag()
+		{
+			if (disposed > 0) return;
+			disposed++;
+
+			this->!CoinStopFlag();
+		}
+
+		!CoinStopFlag()
+		{
+			delete stopFlag;
+			stopFlag = nullptr;
+		}
+	};
+}
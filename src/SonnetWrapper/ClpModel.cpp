@@ -3,3 +3,160 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include "ClpModel.h"
+
+#include <ClpSimplexOther.hpp>
+#include <ClpMessage.hpp>
+#include <ClpInterior.hpp>
+#include <ClpCholeskyBase.hpp>
+#include <ClpCholeskyDense.hpp>
+#if defined(COIN_HAS_AMD) || defined(COIN_HAS_CHOLMOD)
+#include <ClpCholeskyUfl.hpp>
+#endif
+#ifdef COIN_HAS_MUMPS
+#include <ClpCholeskyMumps.hpp>
+#endif
+#ifdef WSSMP_BARRIER
+#include <ClpCholeskyWssmp.hpp>
+#endif
+
+namespace COIN
+{
+	int ClpSimplex::parametrics(double startingTheta, double% endingTheta, double reportIncrement,
+		array<double>^ changeLowerBound, array<double>^ changeUpperBound,
+		array<double>^ changeLowerRhs, array<double>^ changeUpperRhs,
+		array<double>^ changeObjective,
+		array<double>^% thetas, array<double>^% objectiveValues)
+	{
+		::ClpSimplex* model = Base;
+		int n = model->numberColumns();
+		int m = model->numberRows();
+
+		// parametrics changes the bounds and costs while going along theta, so save them here
+		std::vector<double> saveColumnLower(model->columnLower(), model->columnLower() + n);
+		std::vector<double> saveColumnUpper(model->columnUpper(), model->columnUpper() + n);
+		std::vector<double> saveRowLower(model->rowLower(), model->rowLower() + m);
+		std::vector<double> saveRowUpper(model->rowUpper(), model->rowUpper() + m);
+		std::vector<double> saveObjective(model->objective(), model->objective() + n);
+
+		::CoinMessages* messages = model->messagesPointer();
+		ClpParametricsMessageHandler handler(messages->message_[CLP_PARAMETRICS_STATS]->externalNumber(),
+			messages->message_[CLP_PARAMETRICS_STATS2]->externalNumber());
+		handler.setLogLevel(2);
+
+		bool oldDefault;
+		::CoinMessageHandler* oldHandler = model->pushMessageHandler(&handler, oldDefault);
+
+		int result;
+		try
+		{
+			pin_ptr<double> changeLowerBoundPinned = GetPinablePtr(changeLowerBound);
+			pin_ptr<double> changeUpperBoundPinned = GetPinablePtr(changeUpperBound);
+			pin_ptr<double> changeLowerRhsPinned = GetPinablePtr(changeLowerRhs);
+			pin_ptr<double> changeUpperRhsPinned = GetPinablePtr(changeUpperRhs);
+			pin_ptr<double> changeObjectivePinned = GetPinablePtr(changeObjective);
+
+			double ending = endingTheta;
+			result = static_cast<::ClpSimplexOther*>(model)->parametrics(startingTheta, ending, reportIncrement,
+				changeLowerBoundPinned, changeUpperBoundPinned, changeLowerRhsPinned, changeUpperRhsPinned, changeObjectivePinned);
+			endingTheta = ending;
+
+			// the final point is not always reported
+			if (result == 0 && (handler.thetas.empty() || handler.thetas.back() != ending))
+			{
+				handler.thetas.push_back(ending);
+				handler.objectiveValues.push_back(model->objectiveValue());
+			}
+		}
+		catch (::CoinError err)
+		{
+			model->popMessageHandler(oldHandler, oldDefault);
+			throw gcnew CoinError(err);
+		}
+		model->popMessageHandler(oldHandler, oldDefault);
+
+		CoinCopyN(saveColumnLower.data(), n, model->columnLower());
+		CoinCopyN(saveColumnUpper.data(), n, model->columnUpper());
+		CoinCopyN(saveRowLower.data(), m, model->rowLower());
+		CoinCopyN(saveRowUpper.data(), m, model->rowUpper());
+		CoinCopyN(saveObjective.data(), n, model->objective());
+		model->setWhatsChanged(0);	// nothing cached can be trusted anymore
+
+		int k = (int)handler.thetas.size();
+		thetas = gcnew array<double>(k);
+		objectiveValues = gcnew array<double>(k);
+		for (int i = 0; i < k; i++)
+		{
+			thetas[i] = handler.thetas[i];
+			objectiveValues[i] = handler.objectiveValues[i];
+		}
+
+		return result;
+	}
+
+	int ClpSimplex::barrier(bool crossover, ClpCholeskyType choleskyType)
+	{
+		::ClpCholeskyBase* cholesky = nullptr;
+		switch (choleskyType)
+		{
+		case ClpCholeskyType::Native:
+			cholesky = new ::ClpCholeskyBase();
+			break;
+		case ClpCholeskyType::Dense:
+			cholesky = new ::ClpCholeskyDense();
+			break;
+#if defined(COIN_HAS_AMD) || defined(COIN_HAS_CHOLMOD)
+		case ClpCholeskyType::Ufl:
+			cholesky = new ::ClpCholeskyUfl();
+			break;
+#endif
+#ifdef COIN_HAS_MUMPS
+		case ClpCholeskyType::Mumps:
+			cholesky = new ::ClpCholeskyMumps();
+			break;
+#endif
+#ifdef WSSMP_BARRIER
+		case ClpCholeskyType::Wssmp:
+			cholesky = new ::ClpCholeskyWssmp();
+			break;
+#endif
+		default:
+			throw gcnew NotSupportedException(String::Format("The Cholesky type {0} is not available in this build.", choleskyType));
+		}
+
+		::ClpSimplex* model = Base;
+
+		// For QP, the barrier needs to factorize the KKT system
+		bool isQuadratic = (model->objectiveAsObject() != nullptr && model->objectiveAsObject()->type() == 2);
+		if (isQuadratic) cholesky->setKKT(true);
+
+		::ClpInterior interior;
+		interior.borrowModel(*model);
+		interior.setCholesky(cholesky);		// interior now owns cholesky
+		try
+		{
+			interior.primalDual();
+		}
+		catch (::CoinError err)
+		{
+			// always return the borrowed model, otherwise its data would be deleted with interior
+			interior.returnModel(*model);
+			throw gcnew CoinError(err);
+		}
+		interior.returnModel(*model);		// incl. the solution and status
+
+		if (crossover && !isQuadratic && model->status() != 1 && model->status() != 2)
+		{
+			try
+			{
+				// crossover via a values pass of the primal simplex, starting from the barrier solution
+				model->primal(1);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		return model->status();
+	}
+}
@@ -6,8 +6,12 @@
 
 #include <ClpModel.hpp>
 #include <ClpSimplex.hpp>
+#include <CoinMessageHandler.hpp>
+#include <vector>
 
 #include "CoinError.h"
+#include "ClpSolve.h"
+#include "ClpEventHandler.h"
 #include "Helpers.h"
 
 using namespace System;
@@ -36,6 +40,42 @@ namespace COIN
 			Base->modifyCoefficient(row, column, newElement, keepZero);
 		}
 
+		/// Number of rows
+		int getNumRows() { return Base->getNumRows(); }
+		/// Number of columns
+		int getNumCols() { return Base->getNumCols(); }
+
+		/// Status of problem: -1 unknown, 0 optimal, 1 primal infeasible, 2 dual infeasible, 3 stopped on iterations or time, 
+		/// 4 stopped due to errors, 5 stopped by event handler
+		int status() { return Base->status(); }
+		/// Is optimality proven?
+		bool isProvenOptimal() { return Base->isProvenOptimal(); }
+		/// Is primal infeasiblity proven?
+		bool isProvenPrimalInfeasible() { return Base->isProvenPrimalInfeasible(); }
+		/// Is dual infeasiblity proven?
+		bool isProvenDualInfeasible() { return Base->isProvenDualInfeasible(); }
+		/// Objective value
+		double objectiveValue() { return Base->objectiveValue(); }
+		/// Number of iterations
+		int numberIterations() { return Base->numberIterations(); }
+
+		/// Set a single column lower bound. Use -DBL_MAX for -infinity.
+		void setColumnLower(int elementIndex, double elementValue) { Base->setColumnLower(elementIndex, elementValue); }
+		/// Set a single column upper bound. Use DBL_MAX for infinity.
+		void setColumnUpper(int elementIndex, double elementValue) { Base->setColumnUpper(elementIndex, elementValue); }
+		/// Set a single row lower bound. Use -DBL_MAX for -infinity.
+		void setRowLower(int elementIndex, double elementValue) { Base->setRowLower(elementIndex, elementValue); }
+		/// Set a single row upper bound. Use DBL_MAX for infinity.
+		void setRowUpper(int elementIndex, double elementValue) { Base->setRowUpper(elementIndex, elementValue); }
+		/// Set an objective function coefficient
+		void setObjectiveCoefficient(int elementIndex, double elementValue) { Base->setObjectiveCoefficient(elementIndex, elementValue); }
+
+		const double* getColLowerUnsafe() { return Base->getColLower(); }
+		const double* getColUpperUnsafe() { return Base->getColUpper(); }
+		const double* getRowLowerUnsafe() { return Base->getRowLower(); }
+		const double* getRowUpperUnsafe() { return Base->getRowUpper(); }
+		const double* getObjCoefficientsUnsafe() { return Base->getObjCoefficients(); }
+
 		///<summary>Load up quadratic objective. This is stored as a CoinPackedMatrix.
 		/// Adds quadratic component to any existing linear objective.
 		/// It's assumed the matrix is symmetric, so only provide top part.
@@ -124,6 +164,28 @@ namespace COIN
 			}
 		}
 
+		/// Install an event handler that stops the algorithm at the end of the next iteration once the given flag is raised.
+		/// The current event handler remains in use, chained by the new handler.
+		/// If null, the stop flag handler is removed, and the chained handler is installed again.
+		void passInStopFlag(CoinStopFlag ^ stopFlag)
+		{
+			const ClpStopEventHandler * current = dynamic_cast<const ClpStopEventHandler *>(Base->eventHandler());
+
+			if (stopFlag != nullptr)
+			{
+				ClpStopEventHandler handler(stopFlag->Flag);
+				handler.setChainedHandler(Base->eventHandler());
+				Base->passInEventHandler(&handler); // clones the handler, but the stop flag is shared
+			}
+			else if (current != nullptr)
+			{
+				// copy the chained handler first, since passInEventHandler deletes the current handler
+				::ClpEventHandler * chained = current->chainedHandler() != nullptr ? current->chainedHandler()->clone() : new ::ClpEventHandler();
+				Base->passInEventHandler(chained);
+				delete chained;
+			}
+		}
+
 		void loadProblemUnsafe(const int numcols, const int numrows,
 			const CoinBigIndex* start, const int* index,
 			const double* value,
@@ -170,7 +232,78 @@ namespace COIN
 		}
 	};
 
-	public ref class ClpSimplex : ClpModelGeneric<::ClpModel>
+	/// <summary>
+	/// The Cholesky factorization used by the barrier (ClpInterior).
+	/// Apart from Native and Dense, the availability depends on the third party libraries Clp was built with.
+	/// </summary>
+	public enum class ClpCholeskyType
+	{
+		/// <summary>
+		/// Clp's own sparse Cholesky (ClpCholeskyBase)
+		/// </summary>
+		Native = 0,
+		/// <summary>
+		/// Dense Cholesky (ClpCholeskyDense), only for small or dense problems
+		/// </summary>
+		Dense = 1,
+		/// <summary>
+		/// University of Florida AMD/CHOLMOD (ClpCholeskyUfl). Requires Clp built with AMD or CHOLMOD.
+		/// </summary>
+		Ufl = 2,
+		/// <summary>
+		/// MUMPS (ClpCholeskyMumps). Requires Clp built with MUMPS.
+		/// </summary>
+		Mumps = 3,
+		/// <summary>
+		/// WSSMP (ClpCholeskyWssmp). Requires Clp built with WSSMP.
+		/// </summary>
+		Wssmp = 4
+	};
+
+	/// <summary>
+	/// This class is a native class derived from native CoinMessageHandler.
+	/// It records the theta and objective value of the reports of ClpSimplexOther::parametrics, and prints nothing.
+	/// </summary>
+	class ClpParametricsMessageHandler : public ::CoinMessageHandler
+	{
+	public:
+		ClpParametricsMessageHandler(int statsNumber, int stats2Number)
+			: ::CoinMessageHandler()
+		{
+			this->statsNumber = statsNumber;
+			this->stats2Number = stats2Number;
+		}
+
+		virtual ::CoinMessageHandler * clone() const
+		{
+			return new ClpParametricsMessageHandler(*this);
+		}
+
+		virtual int print()
+		{
+			int number = currentMessage().externalNumber();
+			if ((number == statsNumber || number == stats2Number) && numberDoubleFields() >= 2)
+			{
+				// the same theta can be reported more than once
+				double theta = doubleValue(0);
+				if (thetas.empty() || thetas.back() != theta)
+				{
+					thetas.push_back(theta);
+					objectiveValues.push_back(doubleValue(1));
+				}
+			}
+			return 0;
+		}
+
+		std::vector<double> thetas;
+		std::vector<double> objectiveValues;
+
+	private:
+		int statsNumber;
+		int stats2Number;
+	};
+
+	public ref class ClpSimplex : ClpModelGeneric<::ClpSimplex>
 	{
 	public:
 		ClpSimplex()
@@ -206,5 +339,208 @@ namespace COIN
 				throw gcnew CoinError(err);
 			}
 		}
+
+		/// <summary>
+		/// Parametrics via ClpSimplexOther::parametrics. The code uses current bounds + theta * change (if change array not null) 
+		/// and similarly for the objective. It starts at startingTheta and returns the ending theta in endingTheta.
+		/// If reportIncrement is 0.0, it reports on any movement (every breakpoint). 
+		/// If reportIncrement > 0.0, it reports at startingTheta + k * reportIncrement.
+		/// The reported thetas and objective values are returned in thetas and objectiveValues, 
+		/// and together give the piecewise-linear value function.
+		/// Afterwards, the bounds and objective of the model are restored, but the model should be resolved.
+		/// The change arrays have length numberColumns (bounds, objective) or numberRows (rhs).
+		/// Returns 0 if endingTheta was reached, 1 if infeasible, 2 if unbounded, and -1 if there is an error in the ranges.
+		/// On exit, endingTheta is the maximum theta reached (can be used for next startingTheta).
+		/// </summary>
+		int parametrics(double startingTheta, double% endingTheta, double reportIncrement,
+			array<double>^ changeLowerBound, array<double>^ changeUpperBound,
+			array<double>^ changeLowerRhs, array<double>^ changeUpperRhs,
+			array<double>^ changeObjective,
+			[Out] array<double>^% thetas, [Out] array<double>^% objectiveValues);
+
+		/// <summary>
+		/// Returns true iff the slack of the given row is basic in the current basis, that is, the row is not binding.
+		/// </summary>
+		bool isRowBasic(int row)
+		{
+			return Base->getRowStatus(row) == ::ClpSimplex::basic;
+		}
+
+		/// <summary>
+		/// Dual ranging. This computes the increase/decrease in cost for each given variable and the corresponding
+		/// sequence numbers which would change the basis. Sequence numbers are 0..numberColumns-1 for columns, and 
+		/// numberColumns.. for rows (slacks). Up to the user to provide the correct length arrays, namely the length of which.
+		/// If valueIncrease/valueDecrease are not null (length of which), then these are filled with the value the variable
+		/// would go to if the cost increased/decreased that much (basic variables only).
+		/// The model must be optimal when this is called, and is used with its current basis.
+		/// </summary>
+		int dualRanging(array<int>^ which,
+			array<double>^ costIncrease, array<int>^ sequenceIncrease,
+			array<double>^ costDecrease, array<int>^ sequenceDecrease,
+			array<double>^ valueIncrease, array<double>^ valueDecrease)
+		{
+			pin_ptr<int> whichPinned = GetPinablePtr(which);
+			pin_ptr<double> costIncreasePinned = GetPinablePtr(costIncrease);
+			pin_ptr<int> sequenceIncreasePinned = GetPinablePtr(sequenceIncrease);
+			pin_ptr<double> costDecreasePinned = GetPinablePtr(costDecrease);
+			pin_ptr<int> sequenceDecreasePinned = GetPinablePtr(sequenceDecrease);
+			pin_ptr<double> valueIncreasePinned = GetPinablePtr(valueIncrease);
+			pin_ptr<double> valueDecreasePinned = GetPinablePtr(valueDecrease);
+
+			return dualRangingUnsafe(which->Length, whichPinned,
+				costIncreasePinned, sequenceIncreasePinned, costDecreasePinned, sequenceDecreasePinned,
+				valueIncreasePinned, valueDecreasePinned);
+		}
+
+		int dualRanging(array<int>^ which,
+			array<double>^ costIncrease, array<int>^ sequenceIncrease,
+			array<double>^ costDecrease, array<int>^ sequenceDecrease)
+		{
+			return dualRanging(which, costIncrease, sequenceIncrease, costDecrease, sequenceDecrease, nullptr, nullptr);
+		}
+
+		int dualRangingUnsafe(int numberCheck, const int* which,
+			double* costIncrease, int* sequenceIncrease,
+			double* costDecrease, int* sequenceDecrease,
+			double* valueIncrease, double* valueDecrease)
+		{
+			try
+			{
+				return Base->dualRanging(numberCheck, which, costIncrease, sequenceIncrease,
+					costDecrease, sequenceDecrease, valueIncrease, valueDecrease);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		/// <summary>
+		/// Primal ranging. This computes the increase/decrease in value for each given variable and the corresponding
+		/// sequence numbers which would change the basis. Sequence numbers are 0..numberColumns-1 for columns, and 
+		/// numberColumns.. for rows (slacks). For a row, the value is the row activity, so this gives the rhs ranging.
+		/// This should only be used for non-basic variables, since otherwise valueIncrease etc. are 0.0.
+		/// Up to the user to provide the correct length arrays, namely the length of which.
+		/// The model must be optimal when this is called, and is used with its current basis.
+		/// </summary>
+		int primalRanging(array<int>^ which,
+			array<double>^ valueIncrease, array<int>^ sequenceIncrease,
+			array<double>^ valueDecrease, array<int>^ sequenceDecrease)
+		{
+			pin_ptr<int> whichPinned = GetPinablePtr(which);
+			pin_ptr<double> valueIncreasePinned = GetPinablePtr(valueIncrease);
+			pin_ptr<int> sequenceIncreasePinned = GetPinablePtr(sequenceIncrease);
+			pin_ptr<double> valueDecreasePinned = GetPinablePtr(valueDecrease);
+			pin_ptr<int> sequenceDecreasePinned = GetPinablePtr(sequenceDecrease);
+
+			return primalRangingUnsafe(which->Length, whichPinned,
+				valueIncreasePinned, sequenceIncreasePinned, valueDecreasePinned, sequenceDecreasePinned);
+		}
+
+		/// <summary>
+		/// General solve algorithm which can do presolve, using default options.
+		/// Returns the status of the model (0 is optimal).
+		/// </summary>
+		int initialSolve()
+		{
+			try
+			{
+				return Base->initialSolve();
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		/// <summary>
+		/// General solve algorithm which can do presolve, using the given options (algorithm, presolve passes, 
+		/// dual or primal startup such as crash, idiot or sprint).
+		/// Returns the status of the model (0 is optimal).
+		/// </summary>
+		int initialSolve(ClpSolve^ options)
+		{
+			try
+			{
+				return Base->initialSolve(*options->Base);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		/// <summary>
+		/// Solve using the barrier (interior point) with the default Cholesky, followed by crossover 
+		/// to a basic solution if crossover is true. See also barrier(crossover, choleskyType).
+		/// </summary>
+		int barrier(bool crossover)
+		{
+			try
+			{
+				return Base->barrier(crossover);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		/// <summary>
+		/// Solve using the barrier (interior point, ClpInterior) with the given Cholesky factorization.
+		/// For a quadratic objective, the KKT system is factorized, and no crossover is done since 
+		/// the optimal solution is generally not basic.
+		/// If crossover is true, then the barrier solution is moved to an optimal basic solution using primal simplex.
+		/// Returns the status of the model (0 is optimal).
+		/// </summary>
+		int barrier(bool crossover, ClpCholeskyType choleskyType);
+
+		/// <summary>
+		/// Dual simplex algorithm, starting from the current basis and solution of the model.
+		/// If ifValuesPass is 1, then a values pass is done first. Returns the status of the model (0 is optimal).
+		/// </summary>
+		int dual(int ifValuesPass)
+		{
+			try
+			{
+				return Base->dual(ifValuesPass);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		/// <summary>
+		/// Primal simplex algorithm, starting from the current basis and solution of the model.
+		/// If ifValuesPass is 1, then a values pass is done first, for example to clean up after a postsolve. 
+		/// Returns the status of the model (0 is optimal).
+		/// </summary>
+		int primal(int ifValuesPass)
+		{
+			try
+			{
+				return Base->primal(ifValuesPass);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		int primalRangingUnsafe(int numberCheck, const int* which,
+			double* valueIncrease, int* sequenceIncrease,
+			double* valueDecrease, int* sequenceDecrease)
+		{
+			try
+			{
+				return Base->primalRanging(numberCheck, which, valueIncrease, sequenceIncrease,
+					valueDecrease, sequenceDecrease);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "ClpPresolve.h"
+
+namespace COIN
+{
+	ClpSimplex^ ClpPresolve::presolvedModel(ClpSimplex^ si, double feasibilityTolerance, bool keepIntegers, int numberPasses,
+		bool dropNames, bool doRowObjective)
+	{
+		try
+		{
+			::ClpSimplex* reduced = Base->presolvedModel(*si->Base, feasibilityTolerance, keepIntegers, numberPasses, 
+				dropNames, doRowObjective);
+			if (!reduced)
+			{
+				numberPresolvedColumns = 0;
+				numberPresolvedRows = 0;
+				return nullptr;
+			}
+
+			numberPresolvedColumns = reduced->getNumCols();
+			numberPresolvedRows = reduced->getNumRows();
+
+			// The reduced model is new, and ours to delete.
+			ClpSimplex^ result = gcnew ClpSimplex(reduced);
+			result->deleteBase = true;
+			return result;
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	array<int>^ ClpPresolve::originalColumns()
+	{
+		const int* original = Base->originalColumns();
+		array<int>^ result = gcnew array<int>(numberPresolvedColumns);
+		if (original) for (int j = 0; j < numberPresolvedColumns; j++) result[j] = original[j];
+		return result;
+	}
+
+	array<int>^ ClpPresolve::originalRows()
+	{
+		const int* original = Base->originalRows();
+		array<int>^ result = gcnew array<int>(numberPresolvedRows);
+		if (original) for (int i = 0; i < numberPresolvedRows; i++) result[i] = original[i];
+		return result;
+	}
+}
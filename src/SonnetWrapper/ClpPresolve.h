@@ -0,0 +1,128 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <ClpPresolve.hpp>
+
+#include "ClpModel.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// The presolve of Clp. presolvedModel(..) returns a new reduced model of the given (original) model. 
+	/// After the reduced model has been solved, postsolve(..) maps its solution back to the original model.
+	/// The original model must stay alive (and its structure unchanged) until postsolve is done.
+	/// The reduced model and the presolve information can be kept to solve and postsolve repeatedly.
+	/// </summary>
+	public ref class ClpPresolve : WrapperBase<::ClpPresolve>
+	{
+	public:
+		/// Default constructor
+		ClpPresolve() 
+		{
+			numberPresolvedColumns = 0;
+			numberPresolvedRows = 0;
+		}
+
+		/// <summary>
+		/// Presolve the given model with default options. 
+		/// Returns the new reduced model, or null if the model was found to be infeasible or unbounded.
+		/// </summary>
+		ClpSimplex^ presolvedModel(ClpSimplex^ si)
+		{
+			return presolvedModel(si, 0.0, true, 5, false, false);
+		}
+
+		/// <summary>
+		/// Presolve the given model. Bounds are moved by up to feasibilityTolerance to try to stay feasible (0.0 for the
+		/// tolerance of the model). If keepIntegers is true, then bounds of integer variables may be tightened in the original model.
+		/// Returns the new reduced model, or null if the model was found to be infeasible or unbounded.
+		/// </summary>
+		ClpSimplex^ presolvedModel(ClpSimplex^ si, double feasibilityTolerance, bool keepIntegers, int numberPasses)
+		{
+			return presolvedModel(si, feasibilityTolerance, keepIntegers, numberPasses, false, false);
+		}
+
+		/// <summary>
+		/// Presolve the given model, optionally dropping names in the reduced model, and presolving the objective as a row.
+		/// Returns the new reduced model, or null if the model was found to be infeasible or unbounded.
+		/// The reduced model is owned (and deleted) by the returned object.
+		/// </summary>
+		ClpSimplex^ presolvedModel(ClpSimplex^ si, double feasibilityTolerance, bool keepIntegers, int numberPasses, 
+			bool dropNames, bool doRowObjective);
+
+		/// <summary>
+		/// Postsolve the solution of the reduced model into the original model. If updateStatus is true, then the status
+		/// (basis) of the original model is set as well. The solution of the original model may need a clean up, e.g., primal(1).
+		/// </summary>
+		void postsolve(bool updateStatus)
+		{
+			try
+			{
+				Base->postsolve(updateStatus);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		/// <summary>
+		/// Returns for each column of the reduced model the index of the corresponding column in the original model.
+		/// </summary>
+		array<int>^ originalColumns();
+
+		/// <summary>
+		/// Returns for each row of the reduced model the index of the corresponding row in the original model.
+		/// </summary>
+		array<int>^ originalRows();
+
+		/// Whether we want to do dual part of presolve
+		bool doDual() { return Base->doDual(); }
+		void setDoDual(bool doDual) { Base->setDoDual(doDual); }
+		/// Whether we want to do singleton part of presolve
+		bool doSingleton() { return Base->doSingleton(); }
+		void setDoSingleton(bool doSingleton) { Base->setDoSingleton(doSingleton); }
+		/// Whether we want to do doubleton part of presolve
+		bool doDoubleton() { return Base->doDoubleton(); }
+		void setDoDoubleton(bool doDoubleton) { Base->setDoDoubleton(doDoubleton); }
+		/// Whether we want to do tripleton part of presolve
+		bool doTripleton() { return Base->doTripleton(); }
+		void setDoTripleton(bool doTripleton) { Base->setDoTripleton(doTripleton); }
+		/// Whether we want to do tighten part of presolve
+		bool doTighten() { return Base->doTighten(); }
+		void setDoTighten(bool doTighten) { Base->setDoTighten(doTighten); }
+		/// Whether we want to do forcing part of presolve
+		bool doForcing() { return Base->doForcing(); }
+		void setDoForcing(bool doForcing) { Base->setDoForcing(doForcing); }
+		/// Whether we want to do impliedfree part of presolve
+		bool doImpliedFree() { return Base->doImpliedFree(); }
+		void setDoImpliedFree(bool doImpliedfree) { Base->setDoImpliedFree(doImpliedfree); }
+		/// Whether we want to do dupcol part of presolve
+		bool doDupcol() { return Base->doDupcol(); }
+		void setDoDupcol(bool doDupcol) { Base->setDoDupcol(doDupcol); }
+		/// Whether we want to do duprow part of presolve
+		bool doDuprow() { return Base->doDuprow(); }
+		void setDoDuprow(bool doDuprow) { Base->setDoDuprow(doDuprow); }
+		/// Whether we want to do singleton column part of presolve
+		bool doSingletonColumn() { return Base->doSingletonColumn(); }
+		void setDoSingletonColumn(bool doSingleton) { Base->setDoSingletonColumn(doSingleton); }
+
+		/// Set whole presolve action group at once
+		void setPresolveActions(int action) { Base->setPresolveActions(action); }
+		/// Get whole presolve action group
+		int presolveActions() { return Base->presolveActions(); }
+		/// Largest column for substitution (normally 3)
+		void setSubstitution(int value) { Base->setSubstitution(value); }
+
+	private:
+		int numberPresolvedColumns;
+		int numberPresolvedRows;
+	};
+}
@@ -0,0 +1,217 @@
+// Copyright (C) Jan-Willem Goossens
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <ClpSolve.hpp>
+
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// <summary>
+	/// The algorithm used by ClpSimplex::initialSolve(ClpSolve)
+	/// </summary>
+	public enum class ClpSolveType
+	{
+		UseDual = ::ClpSolve::useDual,
+		UsePrimal = ::ClpSolve::usePrimal,
+		UsePrimalOrSprint = ::ClpSolve::usePrimalorSprint,
+		UseBarrier = ::ClpSolve::useBarrier,
+		UseBarrierNoCross = ::ClpSolve::useBarrierNoCross,
+		Automatic = ::ClpSolve::automatic
+	};
+
+	/// <summary>
+	/// The presolve used by ClpSimplex::initialSolve(ClpSolve)
+	/// </summary>
+	public enum class ClpPresolveType
+	{
+		/// <summary>
+		/// Presolve with the default number of passes
+		/// </summary>
+		PresolveOn = ::ClpSolve::presolveOn,
+		/// <summary>
+		/// No presolve
+		/// </summary>
+		PresolveOff = ::ClpSolve::presolveOff,
+		/// <summary>
+		/// Presolve with the given number of passes
+		/// </summary>
+		PresolveNumber = ::ClpSolve::presolveNumber,
+		/// <summary>
+		/// Presolve with the given number of passes, and also on costs
+		/// </summary>
+		PresolveNumberCost = ::ClpSolve::presolveNumberCost
+	};
+
+	/// <summary>
+	/// The startup of the dual simplex, if there is no basis yet (special option 0)
+	/// </summary>
+	public enum class ClpDualStartup
+	{
+		/// <summary>
+		/// All slack basis
+		/// </summary>
+		NoBasis = 0,
+		/// <summary>
+		/// Crash
+		/// </summary>
+		Crash = 1,
+		/// <summary>
+		/// Use initiative about idiot, but no crash
+		/// </summary>
+		IdiotInitiative = 2
+	};
+
+	/// <summary>
+	/// The startup of the primal simplex, if there is no basis yet (special option 1)
+	/// </summary>
+	public enum class ClpPrimalStartup
+	{
+		/// <summary>
+		/// Use initiative
+		/// </summary>
+		Initiative = 0,
+		/// <summary>
+		/// Crash
+		/// </summary>
+		Crash = 1,
+		/// <summary>
+		/// Idiot crash, the number of passes is given as extra info
+		/// </summary>
+		Idiot = 2,
+		/// <summary>
+		/// Sprint, the number of passes is given as extra info. Good for problems with many more columns than rows.
+		/// </summary>
+		Sprint = 3,
+		/// <summary>
+		/// All slack basis
+		/// </summary>
+		AllSlack = 4,
+		/// <summary>
+		/// Use initiative, but no idiot
+		/// </summary>
+		InitiativeNoIdiot = 5,
+		/// <summary>
+		/// Use initiative, but no sprint
+		/// </summary>
+		InitiativeNoSprint = 6,
+		/// <summary>
+		/// Use initiative, but no crash
+		/// </summary>
+		InitiativeNoCrash = 7,
+		/// <summary>
+		/// All slack basis or idiot
+		/// </summary>
+		AllSlackOrIdiot = 8,
+		/// <summary>
+		/// All slack basis or sprint
+		/// </summary>
+		AllSlackOrSprint = 9
+	};
+
+	/// <summary>
+	/// The options of ClpSimplex::initialSolve(ClpSolve): algorithm, presolve, and startup (crash, idiot, sprint).
+	/// </summary>
+	public ref class ClpSolve : WrapperBase<::ClpSolve>
+	{
+	public:
+		/// Default constructor: automatic algorithm and presolve on
+		ClpSolve() { }
+
+		/// Set the algorithm
+		void setSolveType(ClpSolveType method) { Base->setSolveType((::ClpSolve::SolveType)method); }
+		/// Set the algorithm, with extra information
+		void setSolveType(ClpSolveType method, int extraInfo) { Base->setSolveType((::ClpSolve::SolveType)method, extraInfo); }
+		/// Get the algorithm
+		ClpSolveType getSolveType() { return (ClpSolveType)Base->getSolveType(); }
+
+		/// Set the presolve
+		void setPresolveType(ClpPresolveType amount) { Base->setPresolveType((::ClpSolve::PresolveType)amount); }
+		/// Set the presolve, with the number of passes as extra info (for PresolveNumber and PresolveNumberCost)
+		void setPresolveType(ClpPresolveType amount, int extraInfo) { Base->setPresolveType((::ClpSolve::PresolveType)amount, extraInfo); }
+		/// Get the presolve
+		ClpPresolveType getPresolveType() { return (ClpPresolveType)Base->getPresolveType(); }
+		/// Get the number of presolve passes
+		int getPresolvePasses() { return Base->getPresolvePasses(); }
+
+		/// Set the startup of the dual simplex
+		void setDualStartup(ClpDualStartup startup) { Base->setSpecialOption(0, (int)startup); }
+		/// Get the startup of the dual simplex
+		ClpDualStartup getDualStartup() { return (ClpDualStartup)Base->getSpecialOption(0); }
+
+		/// Set the startup of the primal simplex
+		void setPrimalStartup(ClpPrimalStartup startup) { Base->setSpecialOption(1, (int)startup); }
+		/// Set the startup of the primal simplex, with the number of (idiot or sprint) passes
+		void setPrimalStartup(ClpPrimalStartup startup, int numberPasses) { Base->setSpecialOption(1, (int)startup, numberPasses); }
+		/// Get the startup of the primal simplex
+		ClpPrimalStartup getPrimalStartup() { return (ClpPrimalStartup)Base->getSpecialOption(1); }
+
+		/** Special options, see ClpSolve.hpp:
+			which:
+			0 - startup in Dual (see ClpDualStartup)
+			1 - startup in Primal (see ClpPrimalStartup)
+			2 - interrupt handling - 0 yes, 1 no (for threadsafe)
+			3 - whether to make +- 1matrix - 0 yes, 1 no
+			4 - for barrier
+			5 - for presolve, 1 - switch off dual stuff
+			6 - extra switches
+		*/
+		void setSpecialOption(int which, int value) { Base->setSpecialOption(which, value); }
+		/// Set special option, with extra info
+		void setSpecialOption(int which, int value, int extraInfo) { Base->setSpecialOption(which, value, extraInfo); }
+		/// Get special option
+		int getSpecialOption(int which) { return Base->getSpecialOption(which); }
+		/// Get extra info of special option
+		int getExtraInfo(int which) { return Base->getExtraInfo(which); }
+
+		/// Say to return at once if infeasible, default is to solve
+		void setInfeasibleReturn(bool trueFalse) { Base->setInfeasibleReturn(trueFalse); }
+		/// Whether to return at once if infeasible
+		bool infeasibleReturn() { return Base->infeasibleReturn(); }
+
+		/// Whether we want to do dual part of presolve
+		bool doDual() { return Base->doDual(); }
+		void setDoDual(bool doDual) { Base->setDoDual(doDual); }
+		/// Whether we want to do singleton part of presolve
+		bool doSingleton() { return Base->doSingleton(); }
+		void setDoSingleton(bool doSingleton) { Base->setDoSingleton(doSingleton); }
+		/// Whether we want to do doubleton part of presolve
+		bool doDoubleton() { return Base->doDoubleton(); }
+		void setDoDoubleton(bool doDoubleton) { Base->setDoDoubleton(doDoubleton); }
+		/// Whether we want to do tripleton part of presolve
+		bool doTripleton() { return Base->doTripleton(); }
+		void setDoTripleton(bool doTripleton) { Base->setDoTripleton(doTripleton); }
+		/// Whether we want to do tighten part of presolve
+		bool doTighten() { return Base->doTighten(); }
+		void setDoTighten(bool doTighten) { Base->setDoTighten(doTighten); }
+		/// Whether we want to do forcing part of presolve
+		bool doForcing() { return Base->doForcing(); }
+		void setDoForcing(bool doForcing) { Base->setDoForcing(doForcing); }
+		/// Whether we want to do impliedfree part of presolve
+		bool doImpliedFree() { return Base->doImpliedFree(); }
+		void setDoImpliedFree(bool doImpliedFree) { Base->setDoImpliedFree(doImpliedFree); }
+		/// Whether we want to do dupcol part of presolve
+		bool doDupcol() { return Base->doDupcol(); }
+		void setDoDupcol(bool doDupcol) { Base->setDoDupcol(doDupcol); }
+		/// Whether we want to do duprow part of presolve
+		bool doDuprow() { return Base->doDuprow(); }
+		void setDoDuprow(bool doDuprow) { Base->setDoDuprow(doDuprow); }
+		/// Whether we want to do singleton column part of presolve
+		bool doSingletonColumn() { return Base->doSingletonColumn(); }
+		void setDoSingletonColumn(bool doSingleton) { Base->setDoSingletonColumn(doSingleton); }
+
+		/// Set whole presolve action group at once
+		void setPresolveActions(int action) { Base->setPresolveActions(action); }
+		/// Get whole presolve action group
+		int presolveActions() { return Base->presolveActions(); }
+		/// Largest column for substitution (normally 3)
+		void setSubstitution(int value) { Base->setSubstitution(value); }
+		int substitution() { return Base->substitution(); }
+	};
+}
@@ -6,9 +6,135 @@
 
 using namespace System;
 using namespace System::Runtime::InteropServices;
+using namespace System::Threading;
 
 namespace COIN
 {
+	// The state of a race, shared by the caller and the racing threads. Each holds a reference, 
+	// and the last one to release it deletes the clones.
+	private ref class ClpRaceState
+	{
+	public:
+		ClpRaceState(int n, CoinStopFlag^ chainedFlag)
+		{
+			this->n = n;
+			this->chainedFlag = chainedFlag;
+			references = 1;
+			finished = 0;
+			winner = (int)ClpRaceAlgorithms::None;
+			stopFlag = new long(0);
+			clones = new ::OsiClpSolverInterface*[n];
+			handlers = new ::CoinMessageHandler*[n];
+			for (int i = 0; i < n; i++)
+			{
+				clones[i] = nullptr;
+				handlers[i] = nullptr;
+			}
+		}
+
+		void AddReference()
+		{
+			Interlocked::Increment(references);
+		}
+
+		void Release()
+		{
+			if (Interlocked::Decrement(references) > 0) return;
+
+			for (int i = 0; i < n; i++)
+			{
+				delete clones[i];
+				delete handlers[i];
+			}
+			delete[] clones;
+			delete[] handlers;
+			delete stopFlag;
+			clones = nullptr;
+			handlers = nullptr;
+			stopFlag = nullptr;
+		}
+
+		int n;
+		int references;
+		int finished;
+		int winner;
+		volatile long* stopFlag;
+		::OsiClpSolverInterface** clones;
+		::CoinMessageHandler** handlers;
+		// kept alive by the racers, since they may still check it after the race returned
+		CoinStopFlag^ chainedFlag;
+	};
+
+	// Runs one Clp algorithm of a race on its own thread.
+	// The first worker that finishes marks itself the winner and raises the stop flag for the others.
+	private ref class ClpRaceWorker
+	{
+	public:
+		ClpRaceWorker(ClpRaceState^ state, int index, ClpRaceAlgorithms algorithm)
+		{
+			this->state = state;
+			this->index = index;
+			this->algorithm = algorithm;
+		}
+
+		void Run()
+		{
+			try
+			{
+				::ClpSimplex* model = state->clones[index]->getModelPtr();
+				try
+				{
+					switch (algorithm)
+					{
+					case ClpRaceAlgorithms::DualSimplex:
+						model->dual(0);
+						break;
+					case ClpRaceAlgorithms::PrimalSimplex:
+						model->primal(0);
+						break;
+					case ClpRaceAlgorithms::Barrier:
+						model->barrier(true);
+						break;
+					}
+
+					// 0: optimal, 1: primal infeasible, 2: dual infeasible. Anything else (incl. 5: stopped by event) doesnt count.
+					int status = model->status();
+					if (status == 0 || status == 1 || status == 2)
+					{
+						if (Interlocked::CompareExchange(state->winner, (int)algorithm, (int)ClpRaceAlgorithms::None) == (int)ClpRaceAlgorithms::None)
+						{
+							*state->stopFlag = 1;
+						}
+					}
+				}
+				catch (::CoinError)
+				{
+					// this algorithm simply doesnt win
+				}
+
+				Monitor::Enter(state);
+				try
+				{
+					state->finished++;
+					Monitor::PulseAll(state);
+				}
+				finally
+				{
+					Monitor::Exit(state);
+				}
+			}
+			finally
+			{
+				state->Release();
+			}
+		}
+
+	private:
+		ClpRaceState^ state;
+		int index;
+		ClpRaceAlgorithms algorithm;
+	};
+
 	//////////////////////////////////////////////////////
 	///// OsiClpSolverInterface
 	//////////////////////////////////////////////////////
@@ -69,6 +195,96 @@ namespace COIN
 	*/
 #endif
 
+	ClpRaceAlgorithms OsiClpSolverInterface::race(ClpRaceAlgorithms algorithms, CoinStopFlag^ stopFlag)
+	{
+		array<ClpRaceAlgorithms>^ candidates = { ClpRaceAlgorithms::DualSimplex, ClpRaceAlgorithms::PrimalSimplex, ClpRaceAlgorithms::Barrier };
+
+		int n = 0;
+		for each (ClpRaceAlgorithms candidate in candidates) if ((algorithms & candidate) == candidate) n++;
+		if (n == 0) throw gcnew ArgumentException("At least one algorithm must be given to race.", "algorithms");
+
+		ClpRaceState^ state = gcnew ClpRaceState(n, stopFlag);
+		array<ClpRaceAlgorithms>^ racers = gcnew array<ClpRaceAlgorithms>(n);
+		array<Thread^>^ threads = gcnew array<Thread^>(n);
+		try
+		{
+			// the racers stop once the race is won, or once the given flag is raised
+			ClpStopEventHandler stopHandler(state->stopFlag, (stopFlag != nullptr) ? stopFlag->Flag : nullptr);
+
+			int i = 0;
+			for each (ClpRaceAlgorithms candidate in candidates)
+			{
+				if ((algorithms & candidate) != candidate) continue;
+
+				racers[i] = candidate;
+				state->clones[i] = dynamic_cast<::OsiClpSolverInterface*>(Base->clone(true));
+
+				// Each racer logs to its own (silent) handler, since message handlers are not thread-safe.
+				state->handlers[i] = new ::CoinMessageHandler();
+				state->handlers[i]->setLogLevel(0);
+				state->clones[i]->passInMessageHandler(state->handlers[i]);
+				state->clones[i]->getModelPtr()->passInEventHandler(&stopHandler);	// clones the handler, but the stop flags are shared
+
+				ClpRaceWorker^ worker = gcnew ClpRaceWorker(state, i, candidate);
+				threads[i] = gcnew Thread(gcnew ThreadStart(worker, &ClpRaceWorker::Run));
+				threads[i]->IsBackground = true;
+				i++;
+			}
+
+			for (i = 0; i < n; i++)
+			{
+				state->AddReference();
+				threads[i]->Start();
+			}
+
+			// wait for the winner, or for all racers if none wins
+			Monitor::Enter(state);
+			try
+			{
+				while (state->winner == (int)ClpRaceAlgorithms::None && state->finished < n) Monitor::Wait(state);
+			}
+			finally
+			{
+				Monitor::Exit(state);
+			}
+
+			// stop the losers, and wait for them, so they no longer use the CPU once the race returns
+			*state->stopFlag = 1;
+			for (i = 0; i < n; i++) threads[i]->Join();
+
+			ClpRaceAlgorithms result = (ClpRaceAlgorithms)state->winner;
+			if (result == ClpRaceAlgorithms::None)
+			{
+				// stopped by the given flag: the solve is cancelled, so dont solve without the flag
+				if (stopFlag == nullptr || !stopFlag->isStopped()) Base->initialSolve();
+			}
+			else
+			{
+				// the winner's thread no longer uses its clone, which lives until this state is released
+				int w = Array::IndexOf(racers, result);
+				::CoinWarmStart* warmStart = state->clones[w]->getWarmStart();
+				Base->setWarmStart(warmStart);
+				delete warmStart;
+
+				// Starting from the winner's final basis, this takes no (or hardly any) iterations.
+				Base->resolve();
+			}
+
+			return result;
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			// also if a racer could not be started or the resolve failed
+			*state->stopFlag = 1;
+			for (int i = 0; i < n; i++) if (threads[i] != nullptr && threads[i]->IsAlive) threads[i]->Join();
+			state->Release();
+		}
+	}
+
 	//////////////////////////////////////////////////////
 	///// OsiCbcSolverInterface
 	//////////////////////////////////////////////////////
@@ -87,6 +303,8 @@ namespace COIN
 
 		cbcModel->swapSolver(nullptr);
 		Base = new ::OsiCbcSolverInterface(tmp);
+		// the old model is deleted, and the new one can have its address
+		discardModelPtr();
 
 		Base->passInMessageHandler(messageHandler);
 	}
@@ -96,4 +314,52 @@ namespace COIN
 		::OsiCbcSolverInterface* osiCbc = dynamic_cast<::OsiCbcSolverInterface*> (Base);
 		osiCbc->getModelPtr()->saveReferenceSolver();
 	}
+
+	void OsiCbcSolverInterface::saveModelReferenceState()
+	{
+		::CbcModel* cbcModel = Base->getModelPtr();
+		::OsiSolverInterface* solver = cbcModel->solver();
+
+		if (referenceState == nullptr) referenceState = new OsiCbcReferenceState();
+		OsiCbcReferenceState& state = *referenceState;
+
+		state.bounds.save(solver);
+
+		for (int i = 0; i < ::CbcModel::CbcLastIntParam; i++) state.intParam[i] = cbcModel->getIntParam((::CbcModel::CbcIntParam)i);
+		for (int i = 0; i < ::CbcModel::CbcLastDblParam; i++) state.dblParam[i] = cbcModel->getDblParam((::CbcModel::CbcDblParam)i);
+	}
+
+	bool OsiCbcSolverInterface::resetModelToReferenceState()
+	{
+		if (referenceState == nullptr) return false;
+
+		::CbcModel* cbcModel = Base->getModelPtr();
+		::OsiSolverInterface* solver = cbcModel->solver();
+		OsiCbcReferenceState& state = *referenceState;
+
+		try
+		{
+			if (!state.bounds.fits(solver)) return false;
+
+			// As resetToReferenceSolver, clear the incumbent, the counts and status, the objects, heuristics, cut generators, 
+			// node comparison and strategy of the branch and bound, so the next solve starts as on a new model.
+			// A new model has the default node comparison, and no event handler.
+			// This also resets the cutoff, which is restored below with the dual objective limit and the parameters.
+			cbcModel->gutsOfDestructor2();
+			::CbcCompareDefault compareDefault;
+			cbcModel->setNodeComparison(compareDefault);
+			cbcModel->passInEventHandler(nullptr);
+
+			// deletes the cuts (rows) added by the branch and bound, and restores only the column and row bounds that changed
+			state.bounds.restore(solver);
+
+			for (int i = 0; i < ::CbcModel::CbcLastIntParam; i++) cbcModel->setIntParam((::CbcModel::CbcIntParam)i, state.intParam[i]);
+			for (int i = 0; i < ::CbcModel::CbcLastDblParam; i++) cbcModel->setDblParam((::CbcModel::CbcDblParam)i, state.dblParam[i]);
+			return true;
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <OsiClpSolverInterface.hpp>		// check via ClpSimplex_H (?)
 #include <OsiCbcSolverInterface.hpp>		// check via ClpSimplex_H (?)
 //#include <OsiCpxSolverInterface.hpp>		// Uncomment for CPLEX support
@@ -13,12 +15,35 @@
 #include "CbcModel.h"
 #include "CbcStrategy.h"
 #include "ClpModel.h"
+#include "ClpEventHandler.h"
 
 using namespace System;
 using namespace System::Runtime::InteropServices;
 
 namespace COIN
 {
+	/// <summary>
+	/// The Clp algorithms that can take part in an LP race, see OsiClpSolverInterface::race.
+	/// </summary>
+	[Flags]
+	public enum class ClpRaceAlgorithms
+	{
+		None = 0,
+		/// <summary>
+		/// Dual simplex
+		/// </summary>
+		DualSimplex = 1,
+		/// <summary>
+		/// Primal simplex
+		/// </summary>
+		PrimalSimplex = 2,
+		/// <summary>
+		/// Barrier (interior point) followed by crossover
+		/// </summary>
+		Barrier = 4,
+		All = DualSimplex | PrimalSimplex | Barrier
+	};
+
 	//////////////////////////////////////////////////////
 	///// OsiClpSolverInterface
 	//////////////////////////////////////////////////////
@@ -39,11 +64,40 @@ namespace COIN
 		{
 			return gcnew ClpSimplex(Base->getModelPtr());
 		}
+
+		/// <summary>
+		/// Solve the current LP from scratch by racing the given algorithms concurrently, each on its own thread
+		/// and its own clone of this solver. The first algorithm that finishes (optimal, primal or dual infeasible) wins,
+		/// and the others are stopped at their next iteration. The basis of the winner is then loaded into this solver 
+		/// and resolved, such that this solver ends up with the winner's solution and basis. 
+		/// Once there is a winner, the losers are stopped, and the race waits for their threads before it returns.
+		/// Note that the barrier can only be stopped during its crossover, so a losing barrier can delay the return.
+		/// If a stop flag is given, all racers also stop once it is raised.
+		/// Returns the winning algorithm, or None if no algorithm finished. Then, if the stop flag was raised, 
+		/// the LP is not solved; otherwise initialSolve is used.
+		/// </summary>
+		ClpRaceAlgorithms race(ClpRaceAlgorithms algorithms, CoinStopFlag^ stopFlag);
+
+		ClpRaceAlgorithms race(ClpRaceAlgorithms algorithms)
+		{
+			return race(algorithms, nullptr);
+		}
 	};
 
 	//////////////////////////////////////////////////////
 	///// OsiCbcSolverInterface
 	//////////////////////////////////////////////////////
+
+	/// The state of the solver of a Cbc model that a MIP solve may change: bounds, number of rows, cutoff and Cbc parameters.
+	/// Cbc changes the bounds of the solver directly, so the bounds are recorded as a snapshot, and the changes are found
+	/// by comparing with the snapshot, rather than from a log of the changes.
+	struct OsiCbcReferenceState
+	{
+		OsiBoundsSnapshot bounds;
+		int intParam[::CbcModel::CbcLastIntParam];
+		double dblParam[::CbcModel::CbcLastDblParam];
+	};
+
 	public ref class OsiCbcSolverInterface : public OsiSolverInterfaceGeneric<::OsiCbcSolverInterface>
 	{
 	public:
@@ -61,12 +115,23 @@ namespace COIN
 			Base = new ::OsiCbcSolverInterface(solver->Base, nullptr);
 		}
 
-		/// Get pointer to Cbc model
+		/// Get pointer to Cbc model. The same object is returned as long as the Cbc model is the same,
+		/// so it identifies the model, for example for CbcSolverSession. Once this solver replaces its Cbc model 
+		/// (see resetModelToReferenceSolver), a new object is returned, also if the new model has the address of the old one.
 		CbcModel ^ getModelPtr() 
 		{
-			return gcnew CbcModel(Base->getModelPtr());
+			::CbcModel * model = Base->getModelPtr();
+			if (modelPtr == nullptr || modelPtr->Base != model) 
+			{
+				modelPtr = gcnew CbcModel(model);
+				modelGeneration++;
+			}
+			return modelPtr;
 		}
 
+		/// Get the number of Cbc models this solver had, which changes whenever the object returned by getModelPtr changes
+		int getModelGeneration() { return modelGeneration; }
+
 		/// Get pointer to underlying solver
 		inline OsiSolverInterface ^ getRealSolverPtr()
 		{
@@ -76,6 +141,21 @@ namespace COIN
 		void resetModelToReferenceSolver();
 		void saveModelReferenceSolver();
 
+		/// <summary>
+		/// Record the bounds, the number of rows, the cutoff and the parameters of the Cbc model before a MIP solve,
+		/// without cloning the solver. See resetModelToReferenceState.
+		/// </summary>
+		void saveModelReferenceState();
+
+		/// <summary>
+		/// Restore the state recorded by saveModelReferenceState in place: rows added since are deleted, and only the bounds 
+		/// and parameters that changed are reset. As for a new Cbc model, the incumbent, counts and status, objects, heuristics, 
+		/// cut generators, node comparison, strategy and event handler of the Cbc model are cleared. 
+		/// The solution of the MIP solve remains in the solver.
+		/// Returns false if there is no recorded state, or the number of columns changed, and then nothing is restored.
+		/// </summary>
+		bool resetModelToReferenceState();
+
 	protected:
 		property ::OsiCbcSolverInterface * Derived 
 		{
@@ -84,6 +164,34 @@ namespace COIN
 				return dynamic_cast<::OsiCbcSolverInterface*>(Base); 
 			} 
 		}
+
+	private:
+		OsiCbcReferenceState *referenceState;
+		CbcModel ^ modelPtr;
+		int modelGeneration;
+
+		// the cached CbcModel refers to the deleted model from now on
+		void discardModelPtr()
+		{
+			modelPtr = nullptr;
+		}
+
+		int disposed;
+		~OsiCbcSolverInterface()
+		{
+			if (disposed > 0) return;
+
+			discardModelPtr();
+			disposed++;
+
+			this->!OsiCbcSolverInterface();
+		}
+
+		!OsiCbcSolverInterface()
+		{
+			delete referenceState;
+			referenceState = nullptr;
+		}
 	};
 
 /*	// Uncomment for CPLEX support
@@ -21,6 +21,9 @@ namespace COIN
 			int saveLogLevel = 0;
 			if (messageHandler()) saveLogLevel = messageHandler()->logLevel(); 
 
+			::OsiCbcSolverInterface * cbcSolver = dynamic_cast<::OsiCbcSolverInterface *>(Base);
+			if (cbcSolver != nullptr) CglCutGeneratorProxy::startSolve(*(cbcSolver->getModelPtr()));
+
 			Base->branchAndBound();
 
 			if (messageHandler()) messageHandler()->setLogLevel(saveLogLevel);
@@ -691,6 +694,96 @@ namespace COIN
 		}
 	}
 
+	void OsiBoundsSnapshot::save(const ::OsiSolverInterface* solver)
+	{
+		numberColumns = solver->getNumCols();
+		numberRows = solver->getNumRows();
+		colLower.assign(solver->getColLower(), solver->getColLower() + numberColumns);
+		colUpper.assign(solver->getColUpper(), solver->getColUpper() + numberColumns);
+		rowLower.assign(solver->getRowLower(), solver->getRowLower() + numberRows);
+		rowUpper.assign(solver->getRowUpper(), solver->getRowUpper() + numberRows);
+		solver->getDblParam(OsiDualObjectiveLimit, dualObjectiveLimit);
+	}
+
+	int OsiBoundsSnapshot::restore(::OsiSolverInterface* solver)
+	{
+		if (!fits(solver)) return -1;
+		int n = solver->getNumCols();
+		int m = solver->getNumRows();
+
+		// delete the rows (cuts) added since
+		if (m > numberRows)
+		{
+			dirty.clear();
+			for (int i = numberRows; i < m; i++) dirty.push_back(i);
+			solver->deleteRows((int)dirty.size(), &dirty[0]);
+		}
+
+		// collect the columns whose bounds changed first, since setting bounds may invalidate the bound arrays
+		const double* lower = solver->getColLower();
+		const double* upper = solver->getColUpper();
+		dirty.clear();
+		for (int j = 0; j < n; j++)
+		{
+			if (lower[j] != colLower[j] || upper[j] != colUpper[j]) dirty.push_back(j);
+		}
+		for (size_t k = 0; k < dirty.size(); k++)
+		{
+			int j = dirty[k];
+			solver->setColBounds(j, colLower[j], colUpper[j]);
+		}
+		int numberRestored = (int)dirty.size();
+
+		// likewise for the bounds of the remaining rows
+		const double* rowLowerNow = solver->getRowLower();
+		const double* rowUpperNow = solver->getRowUpper();
+		dirty.clear();
+		for (int i = 0; i < numberRows; i++)
+		{
+			if (rowLowerNow[i] != rowLower[i] || rowUpperNow[i] != rowUpper[i]) dirty.push_back(i);
+		}
+		for (size_t k = 0; k < dirty.size(); k++)
+		{
+			int i = dirty[k];
+			solver->setRowBounds(i, rowLower[i], rowUpper[i]);
+		}
+		numberRestored += (int)dirty.size();
+
+		solver->setDblParam(OsiDualObjectiveLimit, dualObjectiveLimit);
+		return numberRestored;
+	}
+
+	void OsiSolverInterface::saveBounds()
+	{
+		try
+		{
+			if (boundsSnapshot == nullptr) boundsSnapshot = new OsiBoundsSnapshot();
+			boundsSnapshot->save(Base);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	int OsiSolverInterface::restoreBounds()
+	{
+		if (boundsSnapshot == nullptr) throw gcnew InvalidOperationException("No bounds were saved.");
+
+		int result;
+		try
+		{
+			result = boundsSnapshot->restore(Base);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+
+		if (result < 0) throw gcnew InvalidOperationException("The saved bounds do not fit the current number of columns or rows.");
+		return result;
+	}
+
 	void OsiSolverInterface::loadProblem(int numcols, int numrows, array<CoinBigIndex> ^start, 
 		array<int> ^ index, array<double> ^value, array<double> ^collb, array<double> ^colub, 
 		array<double> ^obj, array<double> ^rowlb, array<double> ^rowub)
@@ -732,6 +825,20 @@ namespace COIN
 		}
 	}	
 
+	OsiSolverInterface^ OsiSolverInterface::clone()
+	{
+		try
+		{
+			OsiSolverInterface^ result = CreateDerived(Base->clone(true));
+			result->deleteBase = true; // unlike CreateDerived in general, the new object owns the clone
+			return result;
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
 	OsiSolverInterface^ OsiSolverInterface::CreateDerived(::OsiSolverInterface* derived)
 	{
 		if (dynamic_cast<::OsiClpSolverInterface*>(derived))
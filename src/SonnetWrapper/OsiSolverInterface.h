@@ -14,6 +14,7 @@
 #include <CoinMpsIO.hpp>
 #include <OsiSolverParameters.hpp>
 #include <OsiSolverInterface.hpp>
+#include <vector>
 
 #include "Helpers.h"
 
@@ -22,6 +23,33 @@ using namespace System::Runtime::InteropServices;
 
 namespace COIN
 {
+	/// A native snapshot of the column and row bounds, the number of rows and the dual objective limit of a solver,
+	/// to restore only what changed, for example, by a branch and bound.
+	class OsiBoundsSnapshot
+	{
+	public:
+		OsiBoundsSnapshot() : numberColumns(0), numberRows(0), dualObjectiveLimit(0.0) { }
+
+		/// Record the column and row bounds, the number of rows and the dual objective limit of the solver
+		void save(const ::OsiSolverInterface* solver);
+		/// Delete the rows added since save, and restore the column and row bounds that changed and the dual objective limit.
+		/// Returns the number of columns and rows whose bounds were restored, or -1 if the number of columns or rows does not fit.
+		int restore(::OsiSolverInterface* solver);
+		/// Returns true iff the solver fits the snapshot: the same number of columns, and at least the number of rows.
+		bool fits(const ::OsiSolverInterface* solver) const { return solver->getNumCols() == numberColumns && solver->getNumRows() >= numberRows; }
+
+	private:
+		int numberColumns;
+		int numberRows;
+		std::vector<double> colLower;
+		std::vector<double> colUpper;
+		std::vector<double> rowLower;
+		std::vector<double> rowUpper;
+		double dualObjectiveLimit;
+		// the columns or rows whose bounds changed, kept to avoid reallocation
+		std::vector<int> dirty;
+	};
+
 	/// <summary>
 	/// Abstract Base Class for describing an interface to a solver.
 	/// The .NET OsiSolverInterface class.
@@ -207,6 +235,48 @@ namespace COIN
 			setColUpperUnsafe(inputPinned);
 		}
 
+		const double *getRowLowerUnsafe()
+		{
+			return Base->getRowLower();
+		}
+
+		array<double> ^ getRowLower()
+		{
+			int m = Base->getNumRows();
+			double *input = (double *) Base->getRowLower();
+			array<double> ^result = gcnew array<double>(m);
+			System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, m);
+			return result;
+		}
+
+		const double *getRowUpperUnsafe()
+		{
+			return Base->getRowUpper();
+		}
+
+		array<double> ^ getRowUpper()
+		{
+			int m = Base->getNumRows();
+			double *input = (double *) Base->getRowUpper();
+			array<double> ^result = gcnew array<double>(m);
+			System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, m);
+			return result;
+		}
+
+		const double *getObjCoefficientsUnsafe()
+		{
+			return Base->getObjCoefficients();
+		}
+
+		array<double> ^ getObjCoefficients()
+		{
+			int n = Base->getNumCols();
+			double *input = (double *) Base->getObjCoefficients();
+			array<double> ^result = gcnew array<double>(n);
+			System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, n);
+			return result;
+		}
+
 		const double *getColSolutionUnsafe();
 		array<double> ^ getColSolution();
 		void setColSolutionUnsafe(const double *colsol);
@@ -235,6 +305,17 @@ namespace COIN
 		void restoreBaseModel(int numberRows);
 		void saveBaseModel();
 
+		/// <summary>
+		/// Record the column and row bounds, the number of rows and the dual objective limit in a native snapshot, for example, 
+		/// before a branch and bound. Unlike saveBaseModel, the rest of the model is not copied.
+		/// </summary>
+		void saveBounds();
+		/// <summary>
+		/// Restore the snapshot of saveBounds: delete the rows added since, and restore only the column and row bounds that changed
+		/// and the dual objective limit. Returns the number of columns and rows whose bounds were restored.
+		/// </summary>
+		int restoreBounds();
+
 		void loadProblem(int numcols, int numrows, array<CoinBigIndex> ^start, array<int> ^index, array<double> ^value, array<double> ^collb, array<double> ^colub, array<double> ^obj, array<double> ^rowlb, array<double> ^rowub);
 		void loadProblemUnsafe(const int numcols, const int numrows,
 			      const CoinBigIndex * start, const int* index,
@@ -243,8 +324,28 @@ namespace COIN
 			      const double* obj,
 			      const double* rowlb, const double* rowub);
 
+		/// <summary>
+		/// Returns a deep copy of this solver, including the loaded problem, its current state and warm start.
+		/// The returned object is of the same derived type, and owns its own native solver.
+		/// Note, the message handler of the copy is shared with this solver, unless it is the default handler.
+		/// </summary>
+		OsiSolverInterface ^ clone();
 
 		static OsiSolverInterface^ CreateDerived(::OsiSolverInterface* derived);
+
+	private:
+		OsiBoundsSnapshot *boundsSnapshot;
+
+		~OsiSolverInterface()
+		{
+			this->!OsiSolverInterface();
+		}
+
+		!OsiSolverInterface()
+		{
+			delete boundsSnapshot;
+			boundsSnapshot = nullptr;
+		}
 	};
 
 	template <class T> 
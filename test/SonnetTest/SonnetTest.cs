@@ -153,6 +153,35 @@ namespace SonnetTest
                     SonnetTest40();
                     SonnetTest41();
                     SonnetTest42();
+                    SonnetTest43();
+                    SonnetTest44();
+                    SonnetTest45();
+                    SonnetTest46();
+                    SonnetTest47();
+                    SonnetTest48();
+                    SonnetTest49();
+                    SonnetTest50();
+                    SonnetTest51();
+                    SonnetTest52();
+                    SonnetTest53();
+                    SonnetTest54();
+                    SonnetTest55();
+                    SonnetTest56();
+                    SonnetTest57();
+                    SonnetTest58();
+                    SonnetTest59();
+                    SonnetTest60();
+                    SonnetTest61();
+                    SonnetTest62();
+                    SonnetTest63();
+                    SonnetTest64();
+                    SonnetTest65();
+                    SonnetTest66();
+                    SonnetTest67();
+                    SonnetTest68();
+                    SonnetTest69();
+                    SonnetTest70();
+                    SonnetTest71();
 
                     // do these two stress tests last..
                     SonnetTest29();
@@ -2991,6 +3020,1367 @@ namespace SonnetTest
             Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
         }
 
+        public void SonnetTest43()
+        {
+            Console.WriteLine("SonnetTest43 : LP race of dual, primal and barrier");
+
+            string filename = "brandy.mps";
+
+            Model model = Model.New(filename);
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            solver.Solve(true);
+            Assert(solver.IsProvenOptimal);
+            double objectiveValue = model.Objective.Value;
+
+            Model model2 = Model.New(filename);
+            Solver solver2 = new Solver(model2, solverType);
+            solver2.LPAlgorithm = LPAlgorithm.Race;
+            solver2.Solve(true);
+            Assert(solver2.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model2.Objective.Value, objectiveValue) == 0);
+
+            // the race leaves the winner's basis in the solver, so a resolve takes no iterations
+            solver2.Resolve(true);
+            Assert(solver2.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model2.Objective.Value, objectiveValue) == 0);
+        }
+
+        public void SonnetTest44()
+        {
+            Console.WriteLine("SonnetTest44 : Solve scenarios in parallel");
+
+            Model model = new Model();
+            Solver solver = new Solver(model, solverType);
+
+            Variable x0 = new Variable("x0");
+            Variable x1 = new Variable("x1");
+
+            RangeConstraint con0 = -model.Infinity <= x0 * 2 + x1 * 1 <= 10;
+            RangeConstraint con1 = -model.Infinity <= x0 * 1 + x1 * 3 <= 15;
+            model.Add("con0", con0);
+            model.Add("con1", con1);
+            model.Objective = x0 * 3 + x1 * 1 + 2.0;
+            model.ObjectiveSense = ObjectiveSense.Maximise;
+
+            int numberOfScenarios = 20;
+            List<Scenario> scenarios = new List<Scenario>();
+            for (int s = 0; s < numberOfScenarios; s++)
+            {
+                Scenario scenario = new Scenario("Scenario" + s);
+                scenario.SetConstraintBounds(con0, -model.Infinity, 10.0 + s);
+                scenario.SetObjectiveCoefficient(x1, 1.0 + 0.25 * s);
+                if (s % 5 == 4) scenario.SetVariableBounds(x0, 0.0, 1.0);
+                scenarios.Add(scenario);
+            }
+
+            ScenarioResults results = solver.SolveScenarios(scenarios, true);
+            Assert(results.Count == numberOfScenarios);
+
+            // the model and solver are not changed by the scenarios
+            solver.Solve();
+            Assert(solver.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 17.0) == 0);
+
+            // now solve the same scenarios one by one
+            for (int s = 0; s < numberOfScenarios; s++)
+            {
+                con0.Upper = 10.0 + s;
+                model.Objective.SetCoefficient(x1, 1.0 + 0.25 * s);
+                x0.Upper = (s % 5 == 4) ? 1.0 : model.Infinity;
+                solver.Resolve();
+
+                Assert(results.IsProvenOptimal[s] == solver.IsProvenOptimal);
+                Assert(MathExtension.CompareDouble(results.ObjectiveValues[s], model.Objective.Value) == 0);
+                Assert(MathExtension.CompareDouble(results.GetValue(s, x0), x0.Value) == 0);
+                Assert(MathExtension.CompareDouble(results.GetValue(s, x1), x1.Value) == 0);
+            }
+        }
+
+        public void SonnetTest45()
+        {
+            Console.WriteLine("SonnetTest45 : Parametric objective analysis");
+            if (solverType != typeof(OsiClpSolverInterface) && solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = new Model();
+            Solver solver = new Solver(model, solverType);
+
+            Variable x0 = new Variable("x0");
+            Variable x1 = new Variable("x1");
+
+            RangeConstraint con0 = -model.Infinity <= x0 * 2 + x1 * 1 <= 10;
+            RangeConstraint con1 = -model.Infinity <= x0 * 1 + x1 * 3 <= 15;
+            model.Add("con0", con0);
+            model.Add("con1", con1);
+            model.Objective = x0 * 3 + x1 * 1;
+            model.ObjectiveSense = ObjectiveSense.Maximise;
+
+            solver.Solve();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 15.0) == 0);
+
+            // the objective coefficient of x1 becomes 1 + theta
+            // Then the optimal vertex goes from (5,0) to (3,4) at theta = 0.5, and to (0,5) at theta = 8.
+            ParametricDirection direction = new ParametricDirection();
+            direction.SetObjectiveChange(x1, 1.0);
+            ParametricsResult result = solver.Parametrics(direction, 0.0, 10.0);
+
+            Assert(result.Status == 0);
+            Assert(MathExtension.CompareDouble(result.EndingTheta, 10.0) == 0);
+            Assert(result.Thetas.Length == result.ObjectiveValues.Length);
+            Assert(result.Thetas.Length >= 2);
+            for (int i = 0; i < result.Thetas.Length; i++)
+            {
+                double theta = result.Thetas[i];
+                double expected = Math.Max(15.0, Math.Max(13.0 + 4.0 * theta, 5.0 + 5.0 * theta));
+                Assert(MathExtension.CompareDouble(result.ObjectiveValues[i], expected) == 0);
+            }
+
+            // the solver is back at theta = 0
+            Assert(solver.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 15.0) == 0);
+        }
+
+        public void SonnetTest46()
+        {
+            Console.WriteLine("SonnetTest46 : Cost and rhs ranging");
+            if (solverType != typeof(OsiClpSolverInterface) && solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = new Model();
+            Solver solver = new Solver(model, solverType);
+
+            Variable x0 = new Variable("x0");
+            Variable x1 = new Variable("x1");
+
+            RangeConstraint con0 = -model.Infinity <= x0 * 2 + x1 * 1 <= 10;
+            RangeConstraint con1 = -model.Infinity <= x0 * 1 + x1 * 3 <= 15;
+            model.Add("con0", con0);
+            model.Add("con1", con1);
+            model.Objective = -3.0 * x0 - 1.0 * x1;
+            model.ObjectiveSense = ObjectiveSense.Minimise;
+
+            solver.Solve();
+            Assert(solver.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(x0.Value, 5.0) == 0 && MathExtension.CompareDouble(x1.Value, 0.0) == 0);
+
+            RangingResult ranging = solver.Ranging(new Variable[] { x0, x1 }, new Constraint[] { con0 });
+
+            // (5,0) remains optimal while the cost of x0 is at most twice the cost of x1
+            Assert(MathExtension.CompareDouble(ranging.CostIncrease[0], 1.0) == 0);
+            Assert(ranging.CostDecrease[0] == MathUtils.Infinity);
+            Assert(ranging.CostIncrease[1] == MathUtils.Infinity);
+            Assert(MathExtension.CompareDouble(ranging.CostDecrease[1], 0.5) == 0);
+
+            // con0 is binding, and x0 = rhs / 2 remains feasible for con1 while 0 <= rhs <= 30
+            Assert(MathExtension.CompareDouble(ranging.RhsIncrease[0], 20.0) == 0);
+            Assert(MathExtension.CompareDouble(ranging.RhsDecrease[0], 10.0) == 0);
+
+            // con1 is not binding: its rhs can increase without limit, and decrease down to the activity 5
+            RangingResult ranging1 = solver.Ranging(null, new Constraint[] { con1, con0 });
+            Assert(ranging1.RhsIncrease[0] == MathUtils.Infinity);
+            Assert(MathExtension.CompareDouble(ranging1.RhsDecrease[0], 10.0) == 0);
+            Assert(MathExtension.CompareDouble(ranging1.RhsIncrease[1], 20.0) == 0);
+            Assert(MathExtension.CompareDouble(ranging1.RhsDecrease[1], 10.0) == 0);
+        }
+
+        public void SonnetTest47()
+        {
+            Console.WriteLine("SonnetTest47 : Barrier with and without crossover, for LP and QP");
+            if (solverType != typeof(OsiClpSolverInterface) && solverType != typeof(OsiCbcSolverInterface)) return;
+
+            string filename = "brandy.mps";
+
+            Model model = Model.New(filename);
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            solver.Solve(true);
+            Assert(solver.IsProvenOptimal);
+            double objectiveValue = model.Objective.Value;
+
+            foreach (bool crossover in new bool[] { true, false })
+            {
+                Model model2 = Model.New(filename);
+                Solver solver2 = new Solver(model2, solverType);
+                solver2.LPAlgorithm = LPAlgorithm.Barrier;
+                solver2.BarrierCholesky = ClpCholeskyType.Native;
+                solver2.BarrierCrossover = crossover;
+                solver2.Solve(true);
+                Assert(solver2.IsProvenOptimal);
+                Assert(MathExtension.CompareDouble(model2.Objective.Value, objectiveValue) == 0);
+            }
+
+            // QP as in SonnetTestQuad2
+            Variable x1 = new Variable("x1");
+            Variable x2 = new Variable("x2");
+
+            Model qpModel = new Model();
+            Solver qpSolver = new Solver(qpModel, solverType);
+            qpModel.Add(x1 + x2 <= 2);
+            qpModel.Add(-1 * x1 + 2 * x2 <= 2);
+            qpModel.Add(2 * x1 + x2 <= 3);
+            qpModel.Objective = new Objective(0.5 * x1 * x1 + x2 * x2 - x1 * x2 - 2 * x1 - 6 * x2);
+            qpModel.ObjectiveSense = ObjectiveSense.Minimise;
+
+            qpSolver.LPAlgorithm = LPAlgorithm.Barrier;
+            qpSolver.Solve();
+
+            Assert(qpSolver.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(qpModel.Objective.Value, -74 / 9.0) == 0);
+            Assert(MathExtension.CompareDouble(x1.Value, 2.0 / 3.0) == 0 &&
+                MathExtension.CompareDouble(x2.Value, 4.0 / 3.0) == 0);
+        }
+
+        public void SonnetTest48()
+        {
+            Console.WriteLine("SonnetTest48 : LP with ClpSolve options (presolve passes, sprint, idiot)");
+            if (solverType != typeof(OsiClpSolverInterface) && solverType != typeof(OsiCbcSolverInterface)) return;
+
+            string filename = "brandy.mps";
+
+            Model model = Model.New(filename);
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            solver.Solve(true);
+            Assert(solver.IsProvenOptimal);
+            double objectiveValue = model.Objective.Value;
+
+            ClpSolve sprintOptions = new ClpSolve();
+            sprintOptions.setSolveType(ClpSolveType.UsePrimalOrSprint);
+            sprintOptions.setPresolveType(ClpPresolveType.PresolveNumber, 3);
+            sprintOptions.setPrimalStartup(ClpPrimalStartup.Sprint, 5);
+            Assert(sprintOptions.getPrimalStartup() == ClpPrimalStartup.Sprint);
+            Assert(sprintOptions.getPresolvePasses() == 3);
+
+            ClpSolve idiotOptions = new ClpSolve();
+            idiotOptions.setSolveType(ClpSolveType.UsePrimal);
+            idiotOptions.setPresolveType(ClpPresolveType.PresolveOff);
+            idiotOptions.setPrimalStartup(ClpPrimalStartup.Idiot, 10);
+
+            foreach (ClpSolve options in new ClpSolve[] { sprintOptions, idiotOptions })
+            {
+                Model model2 = Model.New(filename);
+                Solver solver2 = new Solver(model2, solverType);
+                solver2.ClpSolveOptions = options;
+                solver2.Solve(true);
+                Assert(solver2.IsProvenOptimal);
+                Assert(MathExtension.CompareDouble(model2.Objective.Value, objectiveValue) == 0);
+
+                // resolves are not affected
+                solver2.Resolve(true);
+                Assert(solver2.IterationCount == 0);
+            }
+        }
+
+        public void SonnetTest49()
+        {
+            Console.WriteLine("SonnetTest49 : Presolve, and bound and objective changes of the presolved model");
+            if (solverType != typeof(OsiClpSolverInterface) && solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Variable[] variables;
+            Model model = Model.New("brandy.mps", out variables);
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            Solver solver2 = new Solver(model, solverType);
+
+            Assert(solver.Presolve());
+            Assert(solver.IsPresolved);
+
+            solver.Solve(true);
+            Assert(solver.IsProvenOptimal);
+            // the postsolve discards the presolved model
+            Assert(!solver.IsPresolved);
+            double objectiveValue = model.Objective.Value;
+
+            solver2.Solve(true);
+            Assert(solver2.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, objectiveValue) == 0);
+
+            // tighten the bound of the largest variable, and change an objective coefficient, of the presolved model
+            Variable x = variables.OrderByDescending(v => v.Value).First();
+            Variable y = variables[1];
+            Assert(solver.Presolve());
+            x.Upper = 0.5 * x.Value;
+            model.Objective.SetCoefficient(y, 2.0 * model.Objective.GetCoefficient(y) + 1.0);
+
+            solver.Resolve(true);
+            bool isProvenOptimal = solver.IsProvenOptimal;
+            objectiveValue = model.Objective.Value;
+
+            solver2.Resolve(true);
+            Assert(solver2.IsProvenOptimal == isProvenOptimal);
+            if (isProvenOptimal) Assert(MathExtension.CompareDouble(model.Objective.Value, objectiveValue) == 0);
+
+            // relaxing, or changing the bounds of a constraint, discards the presolved model, and the next solve presolves again
+            Assert(solver.Presolve());
+            x.Upper = model.Infinity;
+            Assert(!solver.IsPresolved);
+
+            solver.Resolve(true);
+            Assert(solver.IsProvenOptimal);
+            objectiveValue = model.Objective.Value;
+
+            solver2.Resolve(true);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, objectiveValue) == 0);
+
+            Assert(solver.Presolve());
+            Constraint con = model.Constraints.First(c => c.Upper < model.Infinity);
+            con.Upper = con.Upper;
+            Assert(solver.IsPresolved);
+            con.Upper = con.Upper + 1.0;
+            Assert(!solver.IsPresolved);
+
+            solver.ClearPresolve();
+            Assert(!solver.IsPresolved);
+        }
+
+        public void SonnetTest50()
+        {
+            Console.WriteLine("SonnetTest50 : MIP preprocessing with CglPreProcess and direct branch and bound");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            foreach (MIPPreProcess preProcess in new MIPPreProcess[] { MIPPreProcess.All, MIPPreProcess.Probing, MIPPreProcess.Cliques | MIPPreProcess.DuplicateRows })
+            {
+                Model model = Model.New("egout.mps");
+                Assert(model != null);
+                Solver solver = new Solver(model, solverType);
+                solver.MIPPreProcess = preProcess;
+
+                solver.Generate();
+                int numElements = solver.OsiSolver.getNumElements();
+                int numInts = solver.OsiSolver.getNumIntegers();
+
+                solver.Solve();
+                Assert(solver.IsProvenOptimal);
+                Assert(!solver.IsProvenPrimalInfeasible);
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 568.1007) == 0);
+
+                // the original model is not affected by the preprocessing
+                Assert(numElements == solver.OsiSolver.getNumElements());
+                Assert(numInts == solver.OsiSolver.getNumIntegers());
+            }
+
+            Model model2 = Model.New("MIP-124725.mps");
+            Assert(model2 != null);
+            Solver solver2 = new Solver(model2, solverType);
+            solver2.MIPPreProcess = MIPPreProcess.All;
+            solver2.Minimise();
+            Assert(solver2.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model2.Objective.Value, 124725) == 0);
+        }
+
+        public void SonnetTest51()
+        {
+            if (solverType != typeof(COIN.OsiCbcSolverInterface)) return;
+            Console.WriteLine("SonnetTest51 - Cbc with the Cgl cut generators Gomory, MIR2, KnapsackCover, Clique, FlowCover, Twomir, ZeroHalf and RedSplit");
+
+            Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+
+            OsiCbcSolverInterface osisolver = solver.OsiSolver as OsiCbcSolverInterface;
+            Assert(osisolver != null);
+
+            CbcModel cbcModel = osisolver.getModelPtr();
+            cbcModel.setStrategy(new CbcStrategyNull());
+
+            CglGomory gomory = new CglGomory();
+            gomory.setLimitAtRoot(1000);
+            gomory.setLimit(50);
+            Assert(gomory.getLimit() == 50);
+            CglMixedIntegerRounding2 mir = new CglMixedIntegerRounding2();
+            mir.setMAXAGGR_(3);
+            Assert(mir.getMAXAGGR_() == 3);
+            CglKnapsackCover knapsack = new CglKnapsackCover();
+            knapsack.setMaxInKnapsack(100);
+            CglClique clique = new CglClique();
+            clique.setStarCliqueReport(false);
+            clique.setRowCliqueReport(false);
+            CglFlowCover flowCover = new CglFlowCover();
+            CglTwomir twomir = new CglTwomir();
+            twomir.setMaxElements(250);
+            Assert(twomir.getMaxElements() == 250);
+            CglZeroHalf zeroHalf = new CglZeroHalf();
+            CglRedSplit redSplit = new CglRedSplit();
+            redSplit.setLimit(100);
+
+            cbcModel.addCutGenerator(gomory, -98, "Gomory");
+            cbcModel.addCutGenerator(mir, -98, "MixedIntegerRounding2");
+            cbcModel.addCutGenerator(knapsack, -98, "KnapsackCover");
+            cbcModel.addCutGenerator(clique, -98, "Clique");
+            cbcModel.addCutGenerator(flowCover, -98, "FlowCover");
+            cbcModel.addCutGenerator(twomir, -99, "Twomir");
+            cbcModel.addCutGenerator(zeroHalf, -99, "ZeroHalf");
+            cbcModel.addCutGenerator(redSplit, -99, "RedSplit");
+            Assert(cbcModel.numberCutGenerators() == 8);
+
+            string[] names = cbcModel.cutGenerators().Select(generator => generator.generator().GetType().Name).ToArray();
+            Assert(names.SequenceEqual(new string[] { "CglGomory", "CglMixedIntegerRounding2", "CglKnapsackCover", "CglClique", "CglFlowCover", "CglTwomir", "CglZeroHalf", "CglRedSplit" }));
+
+            solver.Minimise();
+
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+        }
+
+        public void SonnetTest52()
+        {
+            if (solverType != typeof(COIN.OsiCbcSolverInterface)) return;
+            Console.WriteLine("SonnetTest52 - Cbc with the heuristics FPump, Rounding, RINS, DiveCoefficient and Local");
+
+            Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+
+            OsiCbcSolverInterface osisolver = solver.OsiSolver as OsiCbcSolverInterface;
+            Assert(osisolver != null);
+
+            // via branchAndBound, the model itself is solved, so the added heuristics keep their counts
+            osisolver.SetCbcSolverArgs("-branchAndBound");
+            CbcModel cbcModel = osisolver.getModelPtr();
+            cbcModel.setStrategy(new CbcStrategyNull());
+
+            CbcHeuristicFPump pump = new CbcHeuristicFPump();
+            pump.setMaximumPasses(20);
+            pump.setMaximumRetries(2);
+            Assert(pump.maximumPasses() == 20);
+            pump.setWhen(1);
+            CbcRounding rounding = new CbcRounding();
+            rounding.setWhen(2);
+            CbcHeuristicRINS rins = new CbcHeuristicRINS();
+            rins.setHowOften(10);
+            rins.setFractionSmall(0.5);
+            CbcHeuristicDiveCoefficient dive = new CbcHeuristicDiveCoefficient();
+            dive.setMaxIterations(50);
+            dive.setWhen(3);
+            CbcHeuristicLocal local = new CbcHeuristicLocal();
+            local.setSearchType(0);
+
+            cbcModel.addHeuristic(rounding, "Rounding");
+            cbcModel.addHeuristic(rins, "RINS");
+            cbcModel.addHeuristic(dive, "DiveCoefficient");
+            cbcModel.addHeuristic(local, "Local");
+            cbcModel.addHeuristic(pump, "FPump", 0);
+            Assert(cbcModel.numberHeuristics() == 5);
+
+            string[] names = cbcModel.heuristics().Select(heuristic => heuristic.GetType().Name).ToArray();
+            Assert(names.SequenceEqual(new string[] { "CbcHeuristicFPump", "CbcRounding", "CbcHeuristicRINS", "CbcHeuristicDiveCoefficient", "CbcHeuristicLocal" }));
+            Assert(cbcModel.heuristic(0).heuristicName() == "FPump");
+            Assert(((CbcHeuristicFPump)cbcModel.heuristic(0)).maximumPasses() == 20);
+            Assert(cbcModel.heuristic(3).when() == 3);
+
+            // the reset after the solve clears the heuristics, so reset manually after the checks
+            solver.AutoResetMIPSolve = false;
+            solver.SaveBeforeMIPSolve();
+            solver.Minimise();
+
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+            Assert(cbcModel.numberHeuristics() == 5);
+            Assert(cbcModel.heuristics().Sum(heuristic => heuristic.numberSolutionsFound()) > 0);
+            solver.ResetAfterMIPSolve();
+        }
+
+        private class BatchCountingCbcEventHandler : CbcEventHandler
+        {
+            public int NumberOfBatches = 0;
+            public int NumberOfEvents = 0;
+
+            protected override bool onEvents(int first, int count)
+            {
+                NumberOfBatches++;
+                NumberOfEvents += count;
+                return false;
+            }
+        }
+
+        public void SonnetTest53()
+        {
+            if (solverType != typeof(COIN.OsiCbcSolverInterface)) return;
+            Console.WriteLine("SonnetTest53 - Cbc event handler with recorded events, batched callbacks and stop after the first solution");
+
+            Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+
+            OsiCbcSolverInterface osisolver = solver.OsiSolver as OsiCbcSolverInterface;
+            Assert(osisolver != null);
+
+            using (BatchCountingCbcEventHandler eventHandler = new BatchCountingCbcEventHandler())
+            {
+                eventHandler.setRecordNodes(true);
+                eventHandler.setBatchSize(10);
+                osisolver.getModelPtr().passInEventHandler(eventHandler);
+
+                solver.Minimise();
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+
+                eventHandler.flush();
+                Assert(eventHandler.NumberOfEvents == eventHandler.numberEvents());
+                Assert(eventHandler.numberSolutions() > 0);
+
+                int n = eventHandler.numberEvents();
+                int lastSolution = -1;
+                for (int i = 0; i < n; i++)
+                {
+                    if (eventHandler.eventSolution(i) >= 0) lastSolution = i;
+                }
+                Assert(lastSolution >= 0);
+                Assert(MathExtension.CompareDouble(eventHandler.eventObjectiveValue(lastSolution), 124725) == 0);
+                
+                double[] values = eventHandler.getSolution(eventHandler.eventSolution(lastSolution));
+                Assert(values.Length == eventHandler.getSolutionLength(eventHandler.eventSolution(lastSolution)));
+            }
+
+            solver.UnGenerate();
+            solver = new Solver(model, solverType);
+            osisolver = solver.OsiSolver as OsiCbcSolverInterface;
+
+            using (CbcEventHandler eventHandler = new CbcEventHandler())
+            {
+                eventHandler.setStopAfterSolutions(1);
+                osisolver.getModelPtr().passInEventHandler(eventHandler);
+
+                solver.Minimise();
+                Assert(eventHandler.numberSolutions() == 1);
+                Assert(eventHandler.eventType(0) == CbcEventType.Solution || eventHandler.eventType(0) == CbcEventType.HeuristicSolution);
+                Assert(model.Objective.Value >= 124725 - 1e-6);
+
+                // the events are per solve, so the next solve also stops after its own first solution
+                osisolver.getModelPtr().passInEventHandler(eventHandler);
+                solver.Minimise();
+                Assert(eventHandler.numberSolutions() == 1);
+                Assert(eventHandler.eventType(0) == CbcEventType.Solution || eventHandler.eventType(0) == CbcEventType.HeuristicSolution);
+            }
+        }
+
+        public void SonnetTest54()
+        {
+            if (solverType != typeof(COIN.OsiCbcSolverInterface)) return;
+            Console.WriteLine("SonnetTest54 - MIP limits: seconds, nodes, solutions, gaps and cutoff, via branchAndBound and CbcMain");
+
+            foreach (bool useBranchAndBound in new bool[] { true, false })
+            {
+                Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+                Assert(model != null);
+                Solver solver = new Solver(model, solverType);
+
+                OsiCbcSolverInterface osisolver = solver.OsiSolver as OsiCbcSolverInterface;
+                Assert(osisolver != null);
+                if (useBranchAndBound) osisolver.SetCbcSolverArgs("-branchAndBound");
+
+                solver.MIPMaximumSeconds = 600.0;
+                solver.MIPMaximumNodes = 100000;
+                solver.MIPMaximumSolutions = 1000;
+                solver.MIPAllowableGap = 1e-6;
+                solver.MIPAllowableFractionGap = 0.0;
+                // the in-place reset after the solve restores the limits of before the solve, 
+                // so the limits on the Cbc model are checked before a manual reset
+                solver.AutoResetMIPSolve = false;
+                try
+                {
+                    solver.SaveBeforeMIPSolve();
+                    solver.Minimise();
+
+                    Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+                    if (useBranchAndBound)
+                    {
+                        CbcModel cbcModel = osisolver.getModelPtr();
+                        Assert(cbcModel.getMaximumNodes() == 100000);
+                        Assert(cbcModel.getMaximumSolutions() == 1000);
+                        Assert(MathExtension.CompareDouble(cbcModel.getMaximumSeconds(), 600.0) == 0);
+                        Assert(!cbcModel.isNodeLimitReached());
+                        Assert(!cbcModel.isSecondsLimitReached());
+                    }
+                    solver.ResetAfterMIPSolve();
+                }
+                finally
+                {
+                    solver.AutoResetMIPSolve = true;
+                }
+
+                // with a cutoff below the optimal value, there is no solution
+                solver.MIPCutoff = 124725 - 10;
+                solver.Minimise();
+                Assert(!solver.IsProvenOptimal);
+
+                solver.MIPCutoff = null;
+                solver.MIPAllowableFractionGap = 0.5;
+                solver.Minimise();
+                Assert(model.Objective.Value >= 124725 - 1e-6);
+                Assert(model.Objective.Value <= 1.5 * 124725);
+            }
+        }
+
+        public void SonnetTest55()
+        {
+            Console.WriteLine("SonnetTest55 : Cancel LP and MIP solves via Cancel, a CancellationToken and a TimeLimit");
+            if (solverType != typeof(OsiClpSolverInterface) && solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = Model.New("brandy.mps");
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+
+            // a cancel before the solve has no effect
+            solver.Cancel();
+            solver.Solve(true);
+            Assert(solver.IsProvenOptimal);
+            Assert(!solver.IsCancelled);
+            double objectiveValue = model.Objective.Value;
+
+            // a cancelled token stops the solve at once
+            System.Threading.CancellationTokenSource source = new System.Threading.CancellationTokenSource();
+            source.Cancel();
+            solver.UnGenerate();
+            solver.CancellationToken = source.Token;
+            solver.Solve(true);
+            Assert(solver.IsCancelled);
+            Assert(!solver.IsProvenOptimal);
+
+            solver.CancellationToken = System.Threading.CancellationToken.None;
+            solver.TimeLimit = TimeSpan.FromMinutes(10);
+            solver.Resolve(true);
+            Assert(!solver.IsCancelled);
+            Assert(solver.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, objectiveValue) == 0);
+
+            if (solver.OsiSolver is OsiClpSolverInterface)
+            {
+                // the stop flag of the solver is chained with the event handler of the Clp model, which remains in use after the solve
+                using (CoinStopFlag userFlag = new CoinStopFlag())
+                {
+                    ((OsiClpSolverInterface)solver.OsiSolver).getModelPtr().passInStopFlag(userFlag);
+                    solver.TimeLimit = null;
+                    solver.UnGenerate();
+                    solver.Solve(true);
+                    Assert(solver.IsProvenOptimal);
+
+                    userFlag.stop();
+                    solver.UnGenerate();
+                    solver.Solve(true);
+                    Assert(!solver.IsProvenOptimal);
+                    Assert(!solver.IsCancelled);
+
+                    ((OsiClpSolverInterface)solver.OsiSolver).getModelPtr().passInStopFlag(null);
+                    solver.UnGenerate();
+                    solver.Solve(true);
+                    Assert(solver.IsProvenOptimal);
+                }
+            }
+
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model mipModel = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(mipModel != null);
+            Solver mipSolver = new Solver(mipModel, solverType);
+            // Cbc may stop on its own maximum seconds before the timer cancels, so IsCancelled is not checked here
+            mipSolver.TimeLimit = TimeSpan.FromMilliseconds(1);
+            mipSolver.Minimise();
+            Assert(!mipSolver.IsProvenOptimal);
+
+            mipSolver.TimeLimit = null;
+            System.Threading.CancellationTokenSource mipSource = new System.Threading.CancellationTokenSource();
+            mipSource.Cancel();
+            mipSolver.CancellationToken = mipSource.Token;
+            mipSolver.Minimise();
+            Assert(mipSolver.IsCancelled);
+            Assert(!mipSolver.IsProvenOptimal);
+
+            mipSolver.CancellationToken = System.Threading.CancellationToken.None;
+            mipSolver.Minimise();
+            Assert(!mipSolver.IsCancelled);
+            Assert(MathExtension.CompareDouble(mipModel.Objective.Value, 124725) == 0);
+        }
+
+        public void SonnetTest56()
+        {
+            Console.WriteLine("SonnetTest56 : Solve telemetry of LP and MIP solves");
+            if (solverType != typeof(OsiClpSolverInterface) && solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = Model.New("brandy.mps");
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            Assert(solver.Telemetry == null);
+
+            solver.CollectTelemetry = true;
+            solver.Solve(true);
+            Assert(solver.IsProvenOptimal);
+
+            SolveTelemetry telemetry = solver.Telemetry;
+            Assert(telemetry != null);
+            Assert(!telemetry.IsMIP);
+            Assert(telemetry.GenerateSeconds >= 0.0 && telemetry.SolveSeconds >= 0.0 && telemetry.AssignSeconds >= 0.0);
+            Assert(telemetry.IterationCount == solver.IterationCount);
+            Assert(telemetry.Seconds.Length == 0);
+            Assert(double.IsNaN(telemetry.RootLPSeconds));
+
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model mipModel = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(mipModel != null);
+            Solver mipSolver = new Solver(mipModel, solverType);
+            ((OsiCbcSolverInterface)mipSolver.OsiSolver).SetCbcSolverArgs("-branchAndBound");
+            mipSolver.CollectTelemetry = true;
+            mipSolver.TelemetryNodeInterval = 1;
+            mipSolver.Minimise();
+            Assert(MathExtension.CompareDouble(mipModel.Objective.Value, 124725) == 0);
+
+            telemetry = mipSolver.Telemetry;
+            Assert(telemetry.IsMIP);
+            Assert(telemetry.RootLPSeconds >= 0.0);
+            Assert(telemetry.IterationCount > 0);
+            int n = telemetry.Seconds.Length;
+            Assert(n > 0);
+            Assert(telemetry.ObjectiveValues.Length == n && telemetry.BestPossibleObjValues.Length == n && telemetry.Gaps.Length == n);
+            Assert(telemetry.NodeCounts.Length == n && telemetry.OpenNodeCounts.Length == n && telemetry.IterationCounts.Length == n);
+
+            double[] objectiveValues = telemetry.ObjectiveValues.Where(value => !double.IsNaN(value)).ToArray();
+            Assert(objectiveValues.Length > 0);
+            Assert(MathExtension.CompareDouble(objectiveValues.Last(), 124725) == 0);
+            for (int i = 1; i < n; i++) Assert(telemetry.Seconds[i] >= telemetry.Seconds[i - 1]);
+
+            // with preprocessing, the counts are those of the branch and bound of the preprocessed model
+            mipSolver.MIPPreProcess = MIPPreProcess.All;
+            mipSolver.Minimise();
+            Assert(MathExtension.CompareDouble(mipModel.Objective.Value, 124725) == 0);
+            telemetry = mipSolver.Telemetry;
+            Assert(double.IsNaN(telemetry.RootLPSeconds));
+            Assert(telemetry.IterationCount > 0);
+            Assert(telemetry.NodeCount == telemetry.NodeCounts.Last());
+            mipSolver.MIPPreProcess = MIPPreProcess.None;
+
+            // the event handler of the telemetry is removed after the solve
+            mipSolver.CollectTelemetry = false;
+            mipSolver.Minimise();
+            Assert(mipSolver.Telemetry == null);
+            Assert(MathExtension.CompareDouble(mipModel.Objective.Value, 124725) == 0);
+        }
+
+        public void SonnetTest57()
+        {
+            Console.WriteLine("SonnetTest57 : MIP start from a previous or user-supplied solution");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Variable[] variables;
+            Model model = Model.New("MIP-124725.mps", out variables); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            ((OsiCbcSolverInterface)solver.OsiSolver).SetCbcSolverArgs("-branchAndBound");
+            Assert(!solver.HasMIPStart);
+
+            solver.Minimise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+            Assert(!solver.IsMIPStartAccepted);
+
+            // the previous solution is feasible and optimal
+            solver.SetMIPStart();
+            Assert(solver.HasMIPStart);
+            solver.Minimise();
+            Assert(solver.IsMIPStartAccepted);
+            Assert(!solver.HasMIPStart); // only used once
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+
+            // with preprocessing, the optimal start is only used as cutoff, which must not prune the optimum
+            solver.MIPPreProcess = MIPPreProcess.All;
+            solver.SetMIPStart();
+            solver.Minimise();
+            Assert(solver.IsMIPStartAccepted);
+            Assert(solver.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+            solver.MIPPreProcess = MIPPreProcess.None;
+
+            // a start outside the bounds is not feasible and is ignored
+            solver.SetMIPStart(variables.Select(var => new KeyValuePair<Variable, double>(var, var.Lower - 10.0)));
+            solver.Minimise();
+            Assert(!solver.IsMIPStartAccepted);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+
+            solver.SetMIPStart();
+            solver.ClearMIPStart();
+            Assert(!solver.HasMIPStart);
+        }
+
+        public void SonnetTest58()
+        {
+            Console.WriteLine("SonnetTest58 : Persistent CbcMain setup for repeated MIP solves via CbcSolverSession");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+
+            // the default CbcMain path of Solver uses a session
+            solver.Minimise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+            solver.Minimise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+
+            OsiCbcSolverInterface osisolver = solver.OsiSolver as OsiCbcSolverInterface;
+            using (CbcSolverSession session = new CbcSolverSession())
+            {
+                string[] args = new string[] { "Sonnet", "-solve", "-quit" };
+                Assert(session.prepare(args, osisolver.getModelPtr()));
+                session.CbcMain1();
+                Assert(MathExtension.CompareDouble(osisolver.getModelPtr().getObjValue(), 124725) == 0);
+
+                // same model and arguments: no new setup
+                Assert(!session.prepare(new string[] { "Sonnet", "-solve", "-quit" }, osisolver.getModelPtr()));
+                session.CbcMain1();
+                Assert(MathExtension.CompareDouble(osisolver.getModelPtr().getObjValue(), 124725) == 0);
+                Assert(session.numberSetups() == 1);
+
+                // other arguments: new setup
+                Assert(session.prepare(new string[] { "Sonnet", "-maxNodes", "100000", "-solve", "-quit" }, osisolver.getModelPtr()));
+                session.CbcMain1();
+                Assert(session.numberSetups() == 2);
+            }
+        }
+
+        public void SonnetTest59()
+        {
+            Console.WriteLine("SonnetTest59 : In-place reset of the bounds, rows and cutoff after a MIP solve");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            ((OsiCbcSolverInterface)solver.OsiSolver).SetCbcSolverArgs("-branchAndBound");
+            solver.Generate();
+
+            OsiCbcSolverInterface osisolver = solver.OsiSolver as OsiCbcSolverInterface;
+            double[] colLower = osisolver.getColLower();
+            double[] colUpper = osisolver.getColUpper();
+            int numberRows = osisolver.getNumRows();
+            double cutoff = osisolver.getModelPtr().getCutoff();
+
+            solver.MIPMaximumNodes = 100000;
+            solver.Minimise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+
+            // the same solver is kept, with the bounds, rows, cutoff and limits of before the solve
+            Assert(object.ReferenceEquals(osisolver, solver.OsiSolver));
+            Assert(osisolver.getNumRows() == numberRows);
+            Assert(colLower.SequenceEqual(osisolver.getColLower()));
+            Assert(colUpper.SequenceEqual(osisolver.getColUpper()));
+            Assert(osisolver.getModelPtr().getCutoff() == cutoff);
+            Assert(osisolver.getModelPtr().getMaximumNodes() != 100000);
+
+            // so a resolve finds the same optimum
+            solver.MIPMaximumNodes = null;
+            solver.Minimise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+        }
+
+        public void SonnetTest60()
+        {
+            Console.WriteLine("SonnetTest60 : Restore only the changed bounds from a native snapshot via saveBounds and restoreBounds");
+
+            Model model = Model.New("brandy.mps");
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            solver.Generate();
+
+            OsiSolverInterface osisolver = solver.OsiSolver;
+            double[] colLower = osisolver.getColLower();
+            double[] colUpper = osisolver.getColUpper();
+            double[] rowLower = osisolver.getRowLower();
+            double[] rowUpper = osisolver.getRowUpper();
+            int numberRows = osisolver.getNumRows();
+
+            osisolver.saveBounds();
+            Assert(osisolver.restoreBounds() == 0);
+
+            osisolver.setColBounds(0, colLower[0] + 1.0, colLower[0] + 1.0);
+            osisolver.setColLower(1, colLower[1] - 1.0);
+            osisolver.setRowBounds(0, rowLower[0] - 1.0, rowUpper[0] + 1.0);
+            osisolver.addRow(1, new int[] { 0 }, new double[] { 1.0 }, 0.0, 10.0);
+            Assert(osisolver.getNumRows() == numberRows + 1);
+
+            Assert(osisolver.restoreBounds() == 3);
+            Assert(osisolver.getNumRows() == numberRows);
+            Assert(colLower.SequenceEqual(osisolver.getColLower()));
+            Assert(colUpper.SequenceEqual(osisolver.getColUpper()));
+            Assert(rowLower.SequenceEqual(osisolver.getRowLower()));
+            Assert(rowUpper.SequenceEqual(osisolver.getRowUpper()));
+
+            solver.Solve(true);
+            Assert(solver.IsProvenOptimal);
+        }
+
+        public void SonnetTest61()
+        {
+            Console.WriteLine("SonnetTest61 : Branching priorities, branch directions and special ordered sets");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = new Model();
+            Variable x1 = new Variable("x1", 0.0, 1.0);
+            Variable x2 = new Variable("x2", 0.0, 1.0);
+            Variable x3 = new Variable("x3", 0.0, 1.0);
+            Variable y = new Variable("y", 0.0, 10.0, VariableType.Integer);
+            model.Add(x1 + x2 + x3 <= 2.0);
+            model.Add(2.0 * y <= 7.0 + x1);
+            model.Objective = x1 + 2.0 * x2 + 3.0 * x3 + y;
+
+            Solver solver = new Solver(model, solverType);
+            ((OsiCbcSolverInterface)solver.OsiSolver).SetCbcSolverArgs("-branchAndBound");
+            solver.Maximise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 2.0 + 3.0 + 3.0) == 0);
+
+            // at most one of x1, x2, x3 nonzero: x1 = 1 and y = 4, or x3 = 1 and y = 3
+            SOSConstraint sos = model.Add(new SOSConstraint(new Variable[] { x1, x2, x3 }, new double[] { 1.0, 2.0, 3.0 }, SOSType.Type1, "sos"));
+            Assert(model.NumberOfSOSConstraints == 1);
+            y.Priority = 10;
+            y.BranchDirection = BranchDirection.Up;
+            // the in-place reset after the solve clears the objects of the Cbc model, 
+            // so the objects are checked before a manual reset
+            solver.AutoResetMIPSolve = false;
+            CbcModel cbcModel = ((OsiCbcSolverInterface)solver.OsiSolver).getModelPtr();
+            try
+            {
+                solver.SaveBeforeMIPSolve();
+                solver.Maximise();
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 3.0 + 3.0) == 0);
+                Assert(MathExtension.CompareDouble(x3.Value, 1.0) == 0);
+
+                Assert(cbcModel.numberObjects() == 2);
+                CbcSimpleInteger integer = cbcModel.object(0) as CbcSimpleInteger;
+                Assert(integer != null && integer.priority() == 10 && integer.preferredWay() == 1);
+                CbcSOS set = cbcModel.object(1) as CbcSOS;
+                Assert(set != null && set.sosType() == 1 && set.numberMembers() == 3);
+
+                solver.ResetAfterMIPSolve();
+            }
+            finally
+            {
+                solver.AutoResetMIPSolve = true;
+            }
+            Assert(cbcModel.numberObjects() == 0);
+        }
+
+        private class SumCutGenerator : CglManagedCutGenerator
+        {
+            public int NumberOfCalls = 0;
+            public double Limit;
+
+            protected override void generateCuts()
+            {
+                NumberOfCalls++;
+
+                // the cut sum x[j] <= Limit, if violated
+                int n = getNumCols();
+                double sum = 0.0;
+                for (int j = 0; j < n; j++) sum += colSolution(j);
+                if (sum > Limit + 1e-6)
+                {
+                    addCut(Enumerable.Range(0, n).ToArray(), Enumerable.Repeat(1.0, n).ToArray(), -MathUtils.Infinity, Limit);
+                }
+            }
+        }
+
+        public void SonnetTest62()
+        {
+            Console.WriteLine("SonnetTest62 : Cut generator written in .NET, with cuts appended natively as one batch");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = new Model();
+            Variable x = new Variable("x", 0.0, 10.0, VariableType.Integer);
+            Variable y = new Variable("y", 0.0, 10.0, VariableType.Integer);
+            model.Add(x - y <= 10.0);
+            model.Objective = x + y;
+
+            Solver solver = new Solver(model, solverType);
+            ((OsiCbcSolverInterface)solver.OsiSolver).SetCbcSolverArgs("-branchAndBound");
+            solver.Generate();
+
+            using (SumCutGenerator generator = new SumCutGenerator())
+            {
+                // x + y <= 15.5 is only enforced by the cut generator, also at solutions (as a lazy constraint)
+                generator.Limit = 15.5;
+                generator.setGloballyValid(true);
+                ((OsiCbcSolverInterface)solver.OsiSolver).getModelPtr().addCutGenerator(generator, 1, "sum", true, true, false);
+
+                solver.Maximise();
+                Assert(generator.callbackException() == null);
+                Assert(generator.NumberOfCalls > 0);
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 15.0) == 0);
+
+                // the reset after the solve removed the generator from the Cbc model, so without it x + y = 20
+                solver.Maximise();
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 20.0) == 0);
+
+                // a generator added to the solver is used by every MIP solve
+                solver.AddCutGenerator(generator, 1, "sum", true, true);
+                Assert(solver.HasCutGenerators);
+                for (int i = 0; i < 2; i++)
+                {
+                    generator.NumberOfCalls = 0;
+                    solver.Maximise();
+                    Assert(generator.NumberOfCalls > 0);
+                    Assert(MathExtension.CompareDouble(model.Objective.Value, 15.0) == 0);
+                }
+
+                solver.ClearCutGenerators();
+                Assert(!solver.HasCutGenerators);
+            }
+        }
+
+        public void SonnetTest63()
+        {
+            Console.WriteLine("SonnetTest63 : Node selection via CbcCompare, incl. the hybrid dive then best-bound comparison");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            CbcModel cbcModel = ((OsiCbcSolverInterface)solver.OsiSolver).getModelPtr();
+            Assert(cbcModel.nodeComparison() is CbcCompareDefault);
+
+            solver.HybridMaximumDiveDepth = 20;
+            foreach (MIPNodeSelection selection in new MIPNodeSelection[] { MIPNodeSelection.DepthFirst, MIPNodeSelection.BestBound, 
+                MIPNodeSelection.BestEstimate, MIPNodeSelection.Hybrid, MIPNodeSelection.Default })
+            {
+                solver.MIPNodeSelection = selection;
+                solver.Minimise();
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+            }
+            Assert(cbcModel.nodeComparison() is CbcCompareDefault);
+
+            CbcCompareHybridDive hybrid = new CbcCompareHybridDive();
+            hybrid.setMaximumDiveDepth(10);
+            hybrid.setDiveNodeLimit(5000);
+            Assert(hybrid.isDiving());
+            cbcModel.setNodeComparison(hybrid);
+            CbcCompareHybridDive copy = cbcModel.nodeComparison() as CbcCompareHybridDive;
+            Assert(copy != null && copy.getMaximumDiveDepth() == 10 && copy.getDiveNodeLimit() == 5000);
+
+            // the limit is only checked every 1000 nodes, so it is rounded up
+            hybrid.setDiveNodeLimit(1);
+            Assert(hybrid.getDiveNodeLimit() == 1000);
+            hybrid.setDiveNodeLimit(5001);
+            Assert(hybrid.getDiveNodeLimit() == 6000);
+            hybrid.setDiveNodeLimit(-1);
+            Assert(hybrid.getDiveNodeLimit() == 0);
+
+            cbcModel.setNodeComparison(null);
+            Assert(cbcModel.nodeComparison() is CbcCompareDefault);
+        }
+
+        public void SonnetTest64()
+        {
+            Console.WriteLine("SonnetTest64 : Pseudocosts learned by a MIP solve, used by the solve of a similar model");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            ((OsiCbcSolverInterface)solver.OsiSolver).SetCbcSolverArgs("-branchAndBound");
+            ((OsiCbcSolverInterface)solver.OsiSolver).getModelPtr().setNumberBeforeTrust(5);
+            solver.Minimise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+
+            PseudoCosts pseudoCosts = solver.GetPseudoCosts();
+            Assert(pseudoCosts != null && pseudoCosts.Count > 0);
+            for (int i = 0; i < pseudoCosts.Count; i++)
+            {
+                Assert(pseudoCosts.Variables[i].Type == VariableType.Integer);
+                Assert(pseudoCosts.NumberTimesDown[i] > 0 || pseudoCosts.NumberTimesUp[i] > 0);
+            }
+
+            // a new model of the same problem: the variables are matched by name
+            Model model2 = Model.New("MIP-124725.mps");
+            Solver solver2 = new Solver(model2, solverType);
+            ((OsiCbcSolverInterface)solver2.OsiSolver).SetCbcSolverArgs("-branchAndBound");
+            ((OsiCbcSolverInterface)solver2.OsiSolver).getModelPtr().setNumberBeforeTrust(5);
+            solver2.SetPseudoCosts(pseudoCosts);
+            Assert(solver2.HasPseudoCosts);
+            // the in-place reset after the solve clears the objects of the Cbc model, 
+            // so the pseudocost objects are checked before a manual reset
+            solver2.AutoResetMIPSolve = false;
+            try
+            {
+                solver2.SaveBeforeMIPSolve();
+                solver2.Minimise();
+                Assert(MathExtension.CompareDouble(model2.Objective.Value, 124725) == 0);
+                Assert(!solver2.HasPseudoCosts);
+
+                CbcModel cbcModel = ((OsiCbcSolverInterface)solver2.OsiSolver).getModelPtr();
+                Assert(cbcModel.object(0) is CbcSimpleIntegerDynamicPseudoCost);
+                solver2.ResetAfterMIPSolve();
+            }
+            finally
+            {
+                solver2.AutoResetMIPSolve = true;
+            }
+            PseudoCosts pseudoCosts2 = solver2.GetPseudoCosts();
+            Assert(pseudoCosts2 != null && pseudoCosts2.Count >= pseudoCosts.Count);
+        }
+
+        public void SonnetTest65()
+        {
+            Console.WriteLine("SonnetTest65 : Cuts of a MIP solve as packed row block, reused by the next solve");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = new Model();
+            Variable x1 = new Variable("x1", 0.0, 1.0);
+            Variable x2 = new Variable("x2", 0.0, 1.0);
+            Variable x3 = new Variable("x3", 0.0, 1.0);
+            Variable y = new Variable("y", 0.0, 10.0, VariableType.Integer);
+            model.Add(x1 + x2 + x3 <= 2.0);
+            model.Add(2.0 * y <= 7.0 + x1);
+            model.Objective = x1 + 2.0 * x2 + 3.0 * x3 + y;
+
+            Solver solver = new Solver(model, solverType);
+            ((OsiCbcSolverInterface)solver.OsiSolver).SetCbcSolverArgs("-branchAndBound");
+            solver.Maximise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 8.0) == 0);
+            int numberRows = solver.OsiSolver.getNumRows();
+
+            // the valid cut y <= 4, tight at the solution, and the cut x1 + x2 <= 2, not tight
+            int j1 = solver.Offset(x1);
+            int j2 = solver.Offset(x2);
+            int jy = solver.Offset(y);
+            CbcCutPool cuts = new CbcCutPool(new int[] { 0, 1, 3 }, new int[] { jy, j1, j2 }, new double[] { 1.0, 1.0, 1.0 },
+                new double[] { -MathUtils.Infinity, -MathUtils.Infinity }, new double[] { 4.0, 2.0 }, new double[] { 4.0, 1.0 });
+            Assert(cuts.numberCuts() == 2 && cuts.numberElements() == 3);
+            Assert(cuts.isTight(0, 1e-6) && !cuts.isTight(1, 1e-6));
+
+            solver.SetCuts(cuts, true);
+            Assert(solver.HasCuts);
+            solver.Maximise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 8.0) == 0);
+            Assert(!solver.HasCuts);
+            // the cuts are a cut pool of the branch and bound, not rows of the model
+            Assert(solver.OsiSolver.getNumRows() == numberRows);
+
+            solver.SetCuts(cuts);
+            solver.Maximise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 8.0) == 0);
+            Assert(solver.OsiSolver.getNumRows() == numberRows);
+        }
+
+        public void SonnetTest66()
+        {
+            Console.WriteLine("SonnetTest66 : Cutoff from the previous solution and objective granularity");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = new Model();
+            Variable a = new Variable("a", 0.0, 10.0, VariableType.Integer);
+            Variable b = new Variable("b", 0.0, 10.0, VariableType.Integer);
+            model.Add(2.0 * a + 3.0 * b <= 12.5);
+            model.Objective = 1.5 * a + 2.5 * b;
+
+            Solver solver = new Solver(model, solverType);
+            solver.MIPObjectiveGranularity = true;
+            solver.MIPCutoffFromSolution = true;
+            solver.Maximise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 10.0) == 0);
+            Assert(!solver.IsMIPStartAccepted);
+
+            // the objective values differ by multiples of 0.5, so the cutoff increment is just below 0.5
+            CbcModel cbcModel = ((OsiCbcSolverInterface)solver.OsiSolver).getModelPtr();
+            cbcModel.setCutoffIncrement(1e-5);
+            cbcModel.analyzeObjective();
+            Assert(cbcModel.getCutoffIncrement() > 0.49 && cbcModel.getCutoffIncrement() < 0.5);
+
+            // the previous solution is still feasible, and gives the cutoff
+            solver.Maximise();
+            Assert(solver.IsMIPStartAccepted);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 10.0) == 0);
+
+            // the previous solution b = 4 is no longer feasible
+            b.Upper = 3.0;
+            solver.Maximise();
+            Assert(!solver.IsMIPStartAccepted);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 9.5) == 0);
+        }
+
+        public void SonnetTest67()
+        {
+            Console.WriteLine("SonnetTest67 : Reduced cost fixing before the branch and bound");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = new Model();
+            Variable[] x = new Variable[4];
+            for (int i = 0; i < x.Length; i++) x[i] = new Variable("x" + i, 0.0, 1.0, VariableType.Integer);
+            model.Add(x[0] + x[1] + x[2] + x[3] >= 1.0);
+            model.Objective = 10.0 * x[0] + 20.0 * x[1] + 30.0 * x[2] + 40.0 * x[3];
+
+            Solver solver = new Solver(model, solverType);
+            solver.MIPReducedCostFixing = true;
+            solver.SetMIPStart(new KeyValuePair<Variable, double>[] { new KeyValuePair<Variable, double>(x[0], 1.0) });
+            solver.Minimise();
+            Assert(solver.IsMIPStartAccepted);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 10.0) == 0);
+
+            // the fixings are undone by the reset after the solve
+            double[] colUpper = solver.OsiSolver.getColUpper();
+            for (int i = 0; i < x.Length; i++) Assert(colUpper[solver.Offset(x[i])] == 1.0);
+
+            // with the cutoff 10.5, the LP objective value 10 leaves a gap smaller than the reduced costs of x1, x2 and x3
+            CbcModel cbcModel = ((OsiCbcSolverInterface)solver.OsiSolver).getModelPtr();
+            cbcModel.setCutoff(10.5);
+            Assert(cbcModel.fixOnReducedCosts(1e-6) == 3);
+            colUpper = solver.OsiSolver.getColUpper();
+            Assert(colUpper[solver.Offset(x[0])] == 1.0);
+            for (int i = 1; i < x.Length; i++) Assert(colUpper[solver.Offset(x[i])] == 0.0);
+        }
+
+        public void SonnetTest68()
+        {
+            Console.WriteLine("SonnetTest68 : In-place reset clears the incumbent, so a tightened model finds its own optimum");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            foreach (bool useBranchAndBound in new bool[] { true, false })
+            {
+                Model model = new Model();
+                Variable x = new Variable("x", 0.0, 10.0, VariableType.Integer);
+                Variable y = new Variable("y", 0.0, 10.0, VariableType.Integer);
+                model.Add(x + y <= 4.5);
+                model.Objective = 3.0 * x + 2.0 * y;
+
+                Solver solver = new Solver(model, solverType);
+                OsiCbcSolverInterface osisolver = (OsiCbcSolverInterface)solver.OsiSolver;
+                if (useBranchAndBound) osisolver.SetCbcSolverArgs("-branchAndBound");
+                solver.Maximise();
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 12.0) == 0);
+                Assert(MathExtension.CompareDouble(x.Value, 4.0) == 0);
+
+                // the old optimum x = 4 is now infeasible, and must not be kept as incumbent
+                x.Upper = 2.0;
+                solver.Maximise();
+                Assert(solver.IsProvenOptimal);
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 10.0) == 0);
+                Assert(MathExtension.CompareDouble(x.Value, 2.0) == 0 && MathExtension.CompareDouble(y.Value, 2.0) == 0);
+
+                CbcModel cbcModel = osisolver.getModelPtr();
+                Assert(cbcModel.numberObjects() == 0);
+                Assert(cbcModel.nodeComparison() is CbcCompareDefault);
+            }
+        }
+
+        public void SonnetTest69()
+        {
+            Console.WriteLine("SonnetTest69 : Repeated solves via CbcMain with CbcSolverArgs, with the same settings and result");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            OsiCbcSolverInterface osisolver = (OsiCbcSolverInterface)solver.OsiSolver;
+            osisolver.SetCbcSolverArgs("-maxNodes", "100000");
+
+            // the same CbcModel object as long as the model is the same, which identifies the model for the session
+            CbcModel cbcModel = osisolver.getModelPtr();
+            Assert(object.ReferenceEquals(cbcModel, osisolver.getModelPtr()));
+
+            solver.Minimise();
+            Assert(solver.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+            int numberBeforeTrust = cbcModel.numberBeforeTrust();
+            int maximumNodes = cbcModel.getMaximumNodes();
+            double cutoffIncrement = cbcModel.getCutoffIncrement();
+            double cutoff = cbcModel.getCutoff();
+
+            // the second solve reuses the setup by CbcMain0, and the reset restores the model as set up by CbcMain0
+            solver.Minimise();
+            Assert(solver.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+            Assert(object.ReferenceEquals(cbcModel, osisolver.getModelPtr()));
+            Assert(cbcModel.numberBeforeTrust() == numberBeforeTrust);
+            Assert(cbcModel.getMaximumNodes() == maximumNodes);
+            Assert(cbcModel.getCutoffIncrement() == cutoffIncrement);
+            Assert(cbcModel.getCutoff() == cutoff);
+
+            // once the solver replaces its Cbc model, getModelPtr returns a new object, so the session does a new setup
+            int generation = osisolver.getModelGeneration();
+            osisolver.saveModelReferenceSolver();
+            osisolver.resetModelToReferenceSolver();
+            Assert(!object.ReferenceEquals(cbcModel, osisolver.getModelPtr()));
+            Assert(osisolver.getModelGeneration() == generation + 1);
+            solver.Minimise();
+            Assert(solver.IsProvenOptimal);
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+        }
+
+        private class FailOnceCutGenerator : SumCutGenerator
+        {
+            public bool Failed = false;
+
+            protected override void generateCuts()
+            {
+                if (!Failed)
+                {
+                    Failed = true;
+                    throw new InvalidOperationException("Failed once");
+                }
+                base.generateCuts();
+            }
+        }
+
+        public void SonnetTest70()
+        {
+            Console.WriteLine("SonnetTest70 : Cut generator written in .NET that fails once, with the exception kept until the next solve");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = new Model();
+            Variable x = new Variable("x", 0.0, 10.0, VariableType.Integer);
+            Variable y = new Variable("y", 0.0, 10.0, VariableType.Integer);
+            model.Add(x - y <= 10.0);
+            model.Objective = x + y;
+
+            Solver solver = new Solver(model, solverType);
+            OsiCbcSolverInterface osisolver = (OsiCbcSolverInterface)solver.OsiSolver;
+            osisolver.SetCbcSolverArgs("-branchAndBound");
+            solver.Generate();
+
+            using (FailOnceCutGenerator generator = new FailOnceCutGenerator())
+            {
+                generator.Limit = 15.5;
+                generator.setGloballyValid(true);
+                osisolver.getModelPtr().addCutGenerator(generator, 1, "sum", true, true, false);
+
+                // the calls after the failed one succeed, and do not clear the exception
+                solver.Maximise();
+                Assert(generator.callbackException() is InvalidOperationException);
+                Assert(generator.NumberOfCalls > 0);
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 15.0) == 0);
+
+                // the reset after the solve removed the cut generators of the model, so add it again. The new solve clears the exception.
+                osisolver.getModelPtr().addCutGenerator(generator, 1, "sum", true, true, false);
+                solver.Maximise();
+                Assert(generator.callbackException() == null);
+                Assert(MathExtension.CompareDouble(model.Objective.Value, 15.0) == 0);
+            }
+        }
+
+        public void SonnetTest71()
+        {
+            Console.WriteLine("SonnetTest71 : Cuts generated by Cbc at the root, exported and reused by the next solve as cut pool");
+            if (solverType != typeof(OsiCbcSolverInterface)) return;
+
+            Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
+            Assert(model != null);
+            Solver solver = new Solver(model, solverType);
+            OsiCbcSolverInterface osisolver = (OsiCbcSolverInterface)solver.OsiSolver;
+            osisolver.SetCbcSolverArgs("-branchAndBound");
+            solver.Generate();
+
+            CbcModel cbcModel = osisolver.getModelPtr();
+            cbcModel.addCutGenerator(new CglGomory(), -98, "Gomory");
+            cbcModel.addCutGenerator(new CglMixedIntegerRounding2(), -98, "MixedIntegerRounding2");
+            cbcModel.addCutGenerator(new CglKnapsackCover(), -98, "KnapsackCover");
+
+            // no cuts are set, so the cuts of the solve are generated by Cbc. These are removed from the solver during the tree search.
+            Assert(!solver.HasCuts);
+            solver.Minimise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+            CbcCutPool cuts = solver.GetCuts();
+            Assert(cuts != null && cuts.numberCuts() > 0);
+            int numberColumns = solver.OsiSolver.getNumCols();
+            Assert(cuts.getColumns().All(j => j >= 0 && j < numberColumns));
+
+            // the cuts are valid, so the next solve with the cuts as pool (and without the cut generators) finds the same optimum
+            solver.SetCuts(cuts);
+            solver.Minimise();
+            Assert(MathExtension.CompareDouble(model.Objective.Value, 124725) == 0);
+        }
+
         public static bool EqualsString(string string1, string string2)
         {
             int n1 = string1.Length;